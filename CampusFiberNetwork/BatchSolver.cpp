@@ -0,0 +1,252 @@
+/**
+ * @file BatchSolver.cpp
+ * @brief 命令行批量求解程序（不依赖Qt）
+ *
+ * 读取若干节点坐标文件（或目录下的全部 .txt 文件），通过 GraphFileIO 建图，
+ * 在线程池上并发求解各文件的最小生成树，按输入顺序输出每个文件的总权重与边列表。
+ *
+ * 用法：
+ *   BatchSolver [选项] <文件或目录>...
+ *   -m, --mode complete|delaunay|knearest|grid|manhattan
+ *                                 建边方式（默认delaunay；前四种为欧氏距离，MST总权重相同，
+ *                                 manhattan按L1距离求MST）
+ *   -k, --neighbors N             knearest方式的近邻数（默认8）
+ *   -j, --threads N               并发数（默认硬件并发数）
+ *   -o, --output FILE             输出文件（默认标准输出）
+ *   -l, --list FILE               从文件读取输入路径列表（每行一个）
+ *   --totals-only                 只输出总权重，不输出边列表
+ *
+ * 输出格式（每个输入文件一段）：
+ *   file <路径> nodes <顶点数> edges <MST边数> total <总权重> status ok|disconnected|error
+ *   <起点> <终点> <权重>
+ *   ...
+ * 进程返回值：全部成功为0，存在读取失败的文件为2，参数错误为1。
+ */
+
+#include "Graph.h"
+#include "GraphFileIO.h"
+#include "Logger.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct Options {
+    EdgeBuildMode mode = EdgeBuildMode::Delaunay;
+    int neighbors = Graph::DEFAULT_CANDIDATE_NEIGHBORS;
+    int threads = 0;
+    std::string outputPath;
+    bool printEdges = true;
+    std::vector<std::string> inputs;
+};
+
+// 单个文件的求解结果（由工作线程填写，主线程按输入顺序输出）
+struct SolveResult {
+    bool ok = false;
+    std::string text;
+};
+
+void printUsage(const char* program) {
+    std::cerr << "用法: " << program
+        << " [-m complete|delaunay|knearest|grid|manhattan] [-k N] [-j N] [-o FILE] [-l LIST] [--totals-only] <文件或目录>..."
+        << std::endl;
+}
+
+bool readListFile(const char* path, std::vector<std::string>& inputs) {
+    std::ifstream list(path);
+    if (!list) {
+        std::cerr << "错误：无法打开列表文件 " << path << std::endl;
+        return false;
+    }
+    std::string line;
+    while (std::getline(list, line)) {
+        // 去除行尾回车与首尾空白，跳过空行和#注释
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') continue;
+        size_t last = line.find_last_not_of(" \t\r");
+        inputs.push_back(line.substr(first, last - first + 1));
+    }
+    return true;
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if ((std::strcmp(arg, "-m") == 0 || std::strcmp(arg, "--mode") == 0) && hasValue) {
+            const char* value = argv[++i];
+            if (std::strcmp(value, "complete") == 0) {
+                options.mode = EdgeBuildMode::Complete;
+            }
+            else if (std::strcmp(value, "delaunay") == 0) {
+                options.mode = EdgeBuildMode::Delaunay;
+            }
+            else if (std::strcmp(value, "knearest") == 0) {
+                options.mode = EdgeBuildMode::KNearest;
+            }
+            else if (std::strcmp(value, "grid") == 0) {
+                options.mode = EdgeBuildMode::SpatialGrid;
+            }
+            else if (std::strcmp(value, "manhattan") == 0) {
+                options.mode = EdgeBuildMode::Manhattan;
+            }
+            else {
+                std::cerr << "错误：未知的建边方式 " << value << std::endl;
+                return false;
+            }
+        }
+        else if ((std::strcmp(arg, "-k") == 0 || std::strcmp(arg, "--neighbors") == 0) && hasValue) {
+            options.neighbors = std::atoi(argv[++i]);
+        }
+        else if ((std::strcmp(arg, "-j") == 0 || std::strcmp(arg, "--threads") == 0) && hasValue) {
+            options.threads = std::atoi(argv[++i]);
+        }
+        else if ((std::strcmp(arg, "-o") == 0 || std::strcmp(arg, "--output") == 0) && hasValue) {
+            options.outputPath = argv[++i];
+        }
+        else if ((std::strcmp(arg, "-l") == 0 || std::strcmp(arg, "--list") == 0) && hasValue) {
+            if (!readListFile(argv[++i], options.inputs)) return false;
+        }
+        else if (std::strcmp(arg, "--totals-only") == 0) {
+            options.printEdges = false;
+        }
+        else if (arg[0] == '-' && arg[1] != '\0') {
+            std::cerr << "错误：未知选项 " << arg << std::endl;
+            return false;
+        }
+        else {
+            options.inputs.push_back(arg);
+        }
+    }
+    return !options.inputs.empty();
+}
+
+/**
+ * @brief 展开输入：文件原样保留，目录替换为其中按名称排序的 .txt 文件
+ */
+std::vector<std::string> collectFiles(const std::vector<std::string>& inputs) {
+    std::vector<std::string> files;
+    for (const std::string& input : inputs) {
+        std::error_code ec;
+        if (fs::is_directory(input, ec)) {
+            std::vector<std::string> entries;
+            for (const fs::directory_entry& entry : fs::directory_iterator(input, ec)) {
+                if (entry.is_regular_file(ec) && entry.path().extension() == ".txt") {
+                    entries.push_back(entry.path().string());
+                }
+            }
+            if (ec) {
+                std::cerr << "警告：遍历目录 " << input << " 时出错: " << ec.message() << std::endl;
+            }
+            std::sort(entries.begin(), entries.end());
+            files.insert(files.end(), entries.begin(), entries.end());
+        }
+        else {
+            files.push_back(input);
+        }
+    }
+    return files;
+}
+
+// 读取一个文件并求解MST，结果格式化为文本
+SolveResult solveFile(const std::string& path, const Options& options) {
+    SolveResult result;
+    std::ostringstream out;
+
+    int vertexCount = GraphFileIO::readVertexCountOnly(path.c_str());
+    if (vertexCount <= 0) {
+        out << "file " << path << " nodes 0 edges 0 total 0 status error\n";
+        result.text = out.str();
+        return result;
+    }
+
+    Graph graph(vertexCount);
+    graph.setCandidateNeighbors(options.neighbors);
+    graph.setWorkerThreads(1); // 已按文件并行，排序与建边不再开线程，避免超额订阅
+    if (!GraphFileIO::readNodesAndBuildGraph(graph, path.c_str(), options.mode)) {
+        out << "file " << path << " nodes " << vertexCount << " edges 0 total 0 status error\n";
+        result.text = out.str();
+        return result;
+    }
+
+    graph.kruskalMST();
+
+    int mstEdgeCount = graph.getMSTEdgeCount();
+    const Edge* mstEdges = graph.getMSTEdges();
+    bool connected = mstEdgeCount == vertexCount - 1;
+    out << "file " << path << " nodes " << vertexCount << " edges " << mstEdgeCount
+        << " total " << static_cast<long long>(graph.getMSTTotalWeight())
+        << " status " << (connected ? "ok" : "disconnected") << '\n';
+    if (options.printEdges) {
+        for (int i = 0; i < mstEdgeCount; i++) {
+            out << mstEdges[i].getSrc() << ' ' << mstEdges[i].getDest() << ' '
+                << mstEdges[i].getWeight() << '\n';
+        }
+    }
+
+    result.ok = true;
+    result.text = out.str();
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // 批量求解时关闭控制台日志；错误仍输出到标准错误
+    Logger::setLevel(Logger::Off);
+
+    std::vector<std::string> files = collectFiles(options.inputs);
+    if (files.empty()) {
+        std::cerr << "错误：没有找到输入文件" << std::endl;
+        return 1;
+    }
+
+    std::ofstream outFile;
+    if (!options.outputPath.empty()) {
+        outFile.open(options.outputPath);
+        if (!outFile) {
+            std::cerr << "错误：无法打开输出文件 " << options.outputPath << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = options.outputPath.empty() ? std::cout : outFile;
+
+    // 每个文件一个任务，由线程池动态分配；结果按输入顺序写出，输出与并发数无关
+    std::vector<SolveResult> results(files.size());
+    ThreadPool pool(options.threads);
+    pool.parallelFor(0, static_cast<int>(files.size()), 1, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            results[i] = solveFile(files[i], options);
+        }
+    });
+
+    int failed = 0;
+    for (const SolveResult& result : results) {
+        out << result.text;
+        if (!result.ok) failed++;
+    }
+    out.flush();
+
+    if (failed > 0) {
+        std::cerr << "共 " << files.size() << " 个文件，其中 " << failed << " 个读取失败" << std::endl;
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file BenchmarkUtil.h
+ * @brief 基准测试程序（GraphBenchmark、UnionFindStress）共用的工具
+ *
+ * 带种子的伪随机数发生器、计时、峰值内存，以及JSON Lines格式的测量输出。
+ * 只供基准测试可执行文件包含，不属于核心库。
+ */
+
+#ifndef BENCHMARK_UTIL_H
+#define BENCHMARK_UTIL_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace Benchmark {
+
+/**
+ * @brief 可复现的伪随机数发生器（SplitMix64）
+ * @note 不使用<random>中的分布，保证不同标准库实现下生成相同的输入
+ */
+class SeededRandom {
+private:
+    uint64_t state;
+
+public:
+    explicit SeededRandom(uint64_t seed) : state(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // [0, 1)均匀实数
+    double uniform() {
+        return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    // [0, n)均匀整数
+    int below(int n) {
+        return static_cast<int>(next() % static_cast<uint64_t>(n));
+    }
+
+    // 标准正态分布（Box-Muller）
+    double gaussian() {
+        double u1 = uniform();
+        double u2 = uniform();
+        if (u1 < 1e-300) u1 = 1e-300;
+        return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+    }
+};
+
+using Clock = std::chrono::steady_clock;
+
+inline long long elapsedNs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+// 进程峰值常驻内存（KB），无法获取时返回-1
+inline long long peakRssKb() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<long long>(counters.PeakWorkingSetSize / 1024);
+    }
+    return -1;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+#ifdef __APPLE__
+    return static_cast<long long>(usage.ru_maxrss / 1024); // macOS以字节为单位
+#else
+    return static_cast<long long>(usage.ru_maxrss);        // Linux以KB为单位
+#endif
+#endif
+}
+
+// 单项测量的公共部分；各程序派生出自己的描述字段（分布、负载、线程数等）
+struct Measurement {
+    const char* bench;    // 被测对象
+    int nodes;            // 规模（顶点数或元素数）
+    long long ops;        // 每次迭代的操作数
+    std::vector<long long> iterationNs;
+
+    // 最快一次迭代的耗时，没有迭代时为0
+    long long bestNs() const {
+        return iterationNs.empty() ? 0 : *std::min_element(iterationNs.begin(), iterationNs.end());
+    }
+
+    double meanNs() const {
+        if (iterationNs.empty()) return 0.0;
+        long long sum = 0;
+        for (long long ns : iterationNs) sum += ns;
+        return static_cast<double>(sum) / iterationNs.size();
+    }
+};
+
+/**
+ * @brief 一行JSON对象中的若干字段（不含花括号），按添加顺序输出
+ * @note 浮点数按固定小数位输出，便于跨版本逐行比较
+ */
+class JsonFields {
+private:
+    std::string text;
+
+    JsonFields& append(const char* name, const char* formatted, bool quoted) {
+        if (!text.empty()) text += ',';
+        text += '"';
+        text += name;
+        text += quoted ? "\":\"" : "\":";
+        text += formatted;
+        if (quoted) text += '"';
+        return *this;
+    }
+
+public:
+    JsonFields& addString(const char* name, const char* value) { return append(name, value, true); }
+
+    JsonFields& addInt(const char* name, long long value) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%lld", value);
+        return append(name, buffer, false);
+    }
+
+    JsonFields& addFixed(const char* name, double value, int decimals) {
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+        return append(name, buffer, false);
+    }
+
+    JsonFields& addBool(const char* name, bool value) { return append(name, value ? "true" : "false", false); }
+
+    const std::string& str() const { return text; }
+};
+
+/**
+ * @brief JSON Lines输出：每项测量一行，写完立即刷新，中途中断也不丢失已完成的结果
+ *
+ * 字段顺序：bench、context（描述字段）、nodes、ops、iterations、seed、
+ * ns_per_op（最快一次迭代）、mean_ns_per_op、results（吞吐量、校验结果等）
+ */
+class Reporter {
+private:
+    std::ostream& out;
+    uint64_t seed;
+
+public:
+    Reporter(std::ostream& stream, uint64_t seedValue) : out(stream), seed(seedValue) {}
+
+    void report(const Measurement& m, const JsonFields& context, const JsonFields& results) {
+        if (m.iterationNs.empty()) return;
+        double ops = static_cast<double>(std::max<long long>(m.ops, 1));
+
+        JsonFields fields;
+        fields.addString("bench", m.bench);
+        std::string line = "{" + fields.str();
+        if (!context.str().empty()) line += "," + context.str();
+
+        char timing[256];
+        std::snprintf(timing, sizeof(timing),
+            ",\"nodes\":%d,\"ops\":%lld,\"iterations\":%d,\"seed\":%llu,\"ns_per_op\":%.3f,\"mean_ns_per_op\":%.3f",
+            m.nodes, m.ops, static_cast<int>(m.iterationNs.size()), static_cast<unsigned long long>(seed),
+            m.bestNs() / ops, m.meanNs() / ops);
+        line += timing;
+        if (!results.str().empty()) line += "," + results.str();
+        line += "}";
+
+        out << line << '\n';
+        out.flush();
+    }
+};
+
+} // namespace Benchmark
+
+#endif // BENCHMARK_UTIL_H
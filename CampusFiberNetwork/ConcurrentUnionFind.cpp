@@ -0,0 +1,87 @@
+/**
+ * @file ConcurrentUnionFind.cpp
+ * @brief 无锁并查集实现文件
+ */
+
+#include "ConcurrentUnionFind.h"
+#include <utility>
+
+ConcurrentUnionFind::ConcurrentUnionFind(int n, uint32_t seed) : seed(seed) {
+    reset(n);
+}
+
+void ConcurrentUnionFind::reset(int n) {
+    if (n < 0) {
+        n = 0;
+    }
+    if (static_cast<int>(parent.size()) != n) {
+        parent = std::vector<std::atomic<int>>(n); // std::atomic不可移动，只能整体重建
+    }
+    for (int i = 0; i < n; ++i) {
+        parent[i].store(i, std::memory_order_relaxed);
+    }
+}
+
+// Find操作（路径折半）：每经过一个节点，尝试把它的父指针改为祖父
+int ConcurrentUnionFind::find(int x) {
+    while (true) {
+        int p = parent[x].load(std::memory_order_acquire);
+        if (p == x) {
+            return x;
+        }
+        int grandparent = parent[p].load(std::memory_order_acquire);
+        if (grandparent != p) {
+            // 祖父是父的祖先，改指祖父不改变划分；失败说明已被其他线程改得更高，忽略
+            parent[x].compare_exchange_weak(p, grandparent,
+                std::memory_order_release, std::memory_order_relaxed);
+        }
+        x = grandparent;
+    }
+}
+
+// Union/Unite操作（按优先级合并）
+bool ConcurrentUnionFind::unite(int x, int y) {
+    while (true) {
+        x = find(x);
+        y = find(y);
+        if (x == y) {
+            return false;
+        }
+
+        // 低优先级的根挂到高优先级的根下
+        if (priority(x) > priority(y)) {
+            std::swap(x, y);
+        }
+        // 只有x仍是根时才挂接；y此后即使被挂到别处，其祖先优先级也更高，不会与x成环
+        int expected = x;
+        if (parent[x].compare_exchange_strong(expected, y,
+                std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return true;
+        }
+        // x已被其他线程合并到别的树，从新的根重试
+    }
+}
+
+// 检查连通性：两根不同且x仍是根时，说明查找期间二者确实不在同一集合
+bool ConcurrentUnionFind::isConnected(int x, int y) {
+    while (true) {
+        x = find(x);
+        y = find(y);
+        if (x == y) {
+            return true;
+        }
+        if (parent[x].load(std::memory_order_acquire) == x) {
+            return false;
+        }
+    }
+}
+
+int ConcurrentUnionFind::countSets() const {
+    int count = 0;
+    for (int i = 0; i < static_cast<int>(parent.size()); ++i) {
+        if (parent[i].load(std::memory_order_relaxed) == i) {
+            count++;
+        }
+    }
+    return count;
+}
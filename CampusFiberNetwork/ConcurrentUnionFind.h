@@ -0,0 +1,66 @@
+/**
+ * @file ConcurrentUnionFind.h
+ * @brief 可多线程并发使用的无锁并查集
+ * @class ConcurrentUnionFind
+ * @brief 父指针为原子变量，find/unite/isConnected可由任意多个线程同时调用
+ *
+ * - 按随机优先级合并：每个元素的优先级是其下标经种子扰动后的32位双射哈希（互不相同），
+ *   合并时优先级低的根挂到优先级高的根下。父指针只会指向优先级更高的元素，因此不会成环，
+ *   且树高期望为O(log n)，不受合并顺序影响（单纯按下标合并在顺序插入时会退化为长链）；
+ * - find为wait-free：路径折半（path halving），用CAS把节点的父指针改为祖父，
+ *   CAS失败说明其他线程已改过，直接跳过；每步都走向优先级更高的元素，步数有上界；
+ * - unite为lock-free：找到两个根后CAS把低优先级根的父指针从自身改为另一根，
+ *   失败说明该根已被其他线程合并，重新查找后重试；
+ * - 与UnionFind（按秩合并+完全路径压缩，非线程安全）结果等价：
+ *   同一组合并操作后划分相同，但根（代表元素）可能不同。
+ */
+
+#ifndef CONCURRENT_UNION_FIND_H
+#define CONCURRENT_UNION_FIND_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+class ConcurrentUnionFind {
+private:
+    std::vector<std::atomic<int>> parent; // 父节点，根指向自身
+    uint32_t seed;                        // 优先级扰动种子
+
+    // 元素 x 的合并优先级（32位双射，不同元素互不相同）
+    uint32_t priority(int x) const {
+        uint32_t h = static_cast<uint32_t>(x) ^ seed;
+        h ^= h >> 16;
+        h *= 0x7FEB352Du;
+        h ^= h >> 15;
+        h *= 0x846CA68Bu;
+        h ^= h >> 16;
+        return h;
+    }
+
+public:
+    // 构造函数：初始化大小为 n 的并查集，seed 决定合并优先级
+    explicit ConcurrentUnionFind(int n, uint32_t seed = 0x9E3779B9u);
+
+    ConcurrentUnionFind(const ConcurrentUnionFind&) = delete;
+    ConcurrentUnionFind& operator=(const ConcurrentUnionFind&) = delete;
+
+    // 重置为 n 个独立集合；不可与其他操作并发调用
+    void reset(int n);
+
+    // 查找元素 x 所在集合的根（线程安全，wait-free）
+    int find(int x);
+
+    // 合并 x 和 y 所在的集合（线程安全，lock-free）；本次调用完成了合并时返回true
+    bool unite(int x, int y);
+
+    // 检查元素 x 和 y 是否属于同一集合（线程安全）
+    bool isConnected(int x, int y);
+
+    int getSize() const { return static_cast<int>(parent.size()); }
+
+    // 统计当前集合数，O(n)；须在没有并发合并时调用
+    int countSets() const;
+};
+
+#endif // CONCURRENT_UNION_FIND_H
@@ -0,0 +1,670 @@
+/**
+ * @file Delaunay.cpp
+ * @brief Delaunay三角剖分实现文件
+ *
+ * 算法流程：
+ * 1. 选取靠近包围盒中心的种子三角形（外接圆最小）
+ * 2. 将其余点按到种子外接圆心的距离排序，依次插入
+ * 3. 每插入一个点，沿凸包向两侧扩展可见边生成新三角形，
+ *    并通过边翻转（legalize）恢复Delaunay性质
+ * 凸包边通过按极角划分的哈希表定位，整体期望复杂度O(n log n)。
+ * 方向与外接圆判定使用自适应精确谓词（Shewchuk）：先做带误差界的浮点计算，
+ * 无法确定符号时再用浮点展开式精确求值，近似共线、近似共圆的输入也不会得到错误的拓扑。
+ */
+
+#include "Delaunay.h"
+#include "KdTree.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace {
+
+const double INF_DIST = std::numeric_limits<double>::infinity();
+
+// 剖分无法完成时改用kd树候选边的近邻数
+const int FALLBACK_NEIGHBORS = 8;
+
+// 两点距离的平方
+inline double squaredDist(double ax, double ay, double bx, double by) {
+    double dx = ax - bx;
+    double dy = ay - by;
+    return dx * dx + dy * dy;
+}
+
+// ---- 精确算术：浮点展开式（若干互不重叠的double之和，按绝对值递增存放） ----
+
+typedef std::vector<double> Expansion;
+
+const double EPSILON = std::numeric_limits<double>::epsilon() / 2; // 2^-53，舍入的相对误差上界
+const double ORIENT_ERROR_BOUND = (3.0 + 16.0 * EPSILON) * EPSILON;
+const double INCIRCLE_ERROR_BOUND = (10.0 + 96.0 * EPSILON) * EPSILON;
+
+// x + y 恰好等于 a + b，x 为浮点和
+inline void twoSum(double a, double b, double& x, double& y) {
+    x = a + b;
+    double bVirtual = x - a;
+    double aVirtual = x - bVirtual;
+    y = (a - aVirtual) + (b - bVirtual);
+}
+
+// 要求 |a| >= |b|
+inline void fastTwoSum(double a, double b, double& x, double& y) {
+    x = a + b;
+    y = b - (x - a);
+}
+
+// x + y 恰好等于 a - b
+inline void twoDiff(double a, double b, double& x, double& y) {
+    x = a - b;
+    double bVirtual = a - x;
+    double aVirtual = x + bVirtual;
+    y = (a - aVirtual) + (bVirtual - b);
+}
+
+// x + y 恰好等于 a * b；fma只舍入一次，余项精确（也不受编译器乘加合并的影响）
+inline void twoProduct(double a, double b, double& x, double& y) {
+    x = a * b;
+    y = std::fma(a, b, -x);
+}
+
+// a - b 的精确展开式
+Expansion diffExpansion(double a, double b) {
+    double x, y;
+    twoDiff(a, b, x, y);
+    return y != 0.0 ? Expansion{ y, x } : Expansion{ x };
+}
+
+// 两个展开式之和（Shewchuk fast_expansion_sum_zeroelim），结果去掉零分量、至少含一个分量
+Expansion sumExpansion(const Expansion& e, const Expansion& f) {
+    Expansion h;
+    h.reserve(e.size() + f.size());
+    size_t ei = 0, fi = 0;
+    auto takeE = [&]() {
+        return fi >= f.size() || (ei < e.size() && ((f[fi] > e[ei]) == (f[fi] > -e[ei])));
+    };
+
+    double q;
+    if (takeE()) q = e[ei++];
+    else q = f[fi++];
+    if (ei < e.size() && fi < f.size()) {
+        double sum, err;
+        if (takeE()) fastTwoSum(e[ei++], q, sum, err);
+        else fastTwoSum(f[fi++], q, sum, err);
+        q = sum;
+        if (err != 0.0) h.push_back(err);
+    }
+    while (ei < e.size() || fi < f.size()) {
+        double sum, err;
+        if (takeE()) twoSum(q, e[ei++], sum, err);
+        else twoSum(q, f[fi++], sum, err);
+        q = sum;
+        if (err != 0.0) h.push_back(err);
+    }
+    if (q != 0.0 || h.empty()) h.push_back(q);
+    return h;
+}
+
+// 展开式乘以一个double（Shewchuk scale_expansion_zeroelim）
+Expansion scaleExpansion(const Expansion& e, double b) {
+    Expansion h;
+    h.reserve(2 * e.size());
+    double q, err;
+    twoProduct(e[0], b, q, err);
+    if (err != 0.0) h.push_back(err);
+    for (size_t i = 1; i < e.size(); i++) {
+        double product, productErr, sum;
+        twoProduct(e[i], b, product, productErr);
+        twoSum(q, productErr, sum, err);
+        if (err != 0.0) h.push_back(err);
+        fastTwoSum(product, sum, q, err);
+        if (err != 0.0) h.push_back(err);
+    }
+    if (q != 0.0 || h.empty()) h.push_back(q);
+    return h;
+}
+
+Expansion productExpansion(const Expansion& a, const Expansion& b) {
+    Expansion result = scaleExpansion(b, a[0]);
+    for (size_t i = 1; i < a.size(); i++) {
+        result = sumExpansion(result, scaleExpansion(b, a[i]));
+    }
+    return result;
+}
+
+Expansion negateExpansion(Expansion e) {
+    for (double& v : e) v = -v;
+    return e;
+}
+
+// 展开式的符号由绝对值最大的（最后一个）分量决定
+inline int expansionSign(const Expansion& e) {
+    double top = e.back();
+    return top > 0 ? 1 : (top < 0 ? -1 : 0);
+}
+
+/**
+ * @brief 方向判定：a、b、c逆时针为1，顺时针为-1，共线为0（精确）
+ */
+int orientSign(double ax, double ay, double bx, double by, double cx, double cy) {
+    double detLeft = (ax - cx) * (by - cy);
+    double detRight = (ay - cy) * (bx - cx);
+    double det = detLeft - detRight;
+    double bound = ORIENT_ERROR_BOUND * (std::fabs(detLeft) + std::fabs(detRight));
+    if (det > bound) return 1;
+    if (-det > bound) return -1;
+    if (bound == 0.0) return 0;
+
+    Expansion left = productExpansion(diffExpansion(ax, cx), diffExpansion(by, cy));
+    Expansion right = productExpansion(diffExpansion(ay, cy), diffExpansion(bx, cx));
+    return expansionSign(sumExpansion(left, negateExpansion(right)));
+}
+
+/**
+ * @brief 外接圆判定：d在逆时针三角形abc的外接圆内为1，圆外为-1，共圆为0（精确；abc顺时针时符号相反）
+ */
+int inCircleSign(double ax, double ay, double bx, double by,
+                 double cx, double cy, double dx, double dy) {
+    double adx = ax - dx, ady = ay - dy;
+    double bdx = bx - dx, bdy = by - dy;
+    double cdx = cx - dx, cdy = cy - dy;
+
+    double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    double cdxady = cdx * ady, adxcdy = adx * cdy;
+    double adxbdy = adx * bdy, bdxady = bdx * ady;
+    double aLift = adx * adx + ady * ady;
+    double bLift = bdx * bdx + bdy * bdy;
+    double cLift = cdx * cdx + cdy * cdy;
+
+    double det = aLift * (bdxcdy - cdxbdy) + bLift * (cdxady - adxcdy) + cLift * (adxbdy - bdxady);
+    double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * aLift
+        + (std::fabs(cdxady) + std::fabs(adxcdy)) * bLift
+        + (std::fabs(adxbdy) + std::fabs(bdxady)) * cLift;
+    double bound = INCIRCLE_ERROR_BOUND * permanent;
+    if (det > bound) return 1;
+    if (-det > bound) return -1;
+    if (bound == 0.0) return 0;
+
+    Expansion eAdx = diffExpansion(ax, dx), eAdy = diffExpansion(ay, dy);
+    Expansion eBdx = diffExpansion(bx, dx), eBdy = diffExpansion(by, dy);
+    Expansion eCdx = diffExpansion(cx, dx), eCdy = diffExpansion(cy, dy);
+
+    auto lift = [](const Expansion& x, const Expansion& y) {
+        return sumExpansion(productExpansion(x, x), productExpansion(y, y));
+    };
+    auto cross = [](const Expansion& x1, const Expansion& y2, const Expansion& x2, const Expansion& y1) {
+        return sumExpansion(productExpansion(x1, y2), negateExpansion(productExpansion(x2, y1)));
+    };
+
+    Expansion termA = productExpansion(lift(eAdx, eAdy), cross(eBdx, eCdy, eCdx, eBdy));
+    Expansion termB = productExpansion(lift(eBdx, eBdy), cross(eCdx, eAdy, eAdx, eCdy));
+    Expansion termC = productExpansion(lift(eCdx, eCdy), cross(eAdx, eBdy, eBdx, eAdy));
+    return expansionSign(sumExpansion(sumExpansion(termA, termB), termC));
+}
+
+// 判断 p、q、r 是否按逆时针排列（精确）
+inline bool orient(double px, double py, double qx, double qy, double rx, double ry) {
+    return orientSign(px, py, qx, qy, rx, ry) > 0;
+}
+
+// 判断点 p 是否位于（顺时针）三角形 abc 的外接圆内（精确）
+inline bool inCircle(double ax, double ay, double bx, double by,
+                     double cx, double cy, double px, double py) {
+    return inCircleSign(ax, ay, bx, by, cx, cy, px, py) < 0;
+}
+
+// 三角形外接圆半径的平方（浮点行列式为0或结果溢出时返回无穷大；共线须先用orientSign判定）
+inline double circumradius(double ax, double ay, double bx, double by, double cx, double cy) {
+    double dx = bx - ax;
+    double dy = by - ay;
+    double ex = cx - ax;
+    double ey = cy - ay;
+
+    double bl = dx * dx + dy * dy;
+    double cl = ex * ex + ey * ey;
+    double det = dx * ey - dy * ex;
+    if (det == 0.0) {
+        return INF_DIST;
+    }
+    double d = 0.5 / det;
+
+    double x = (ey * bl - dy * cl) * d;
+    double y = (dx * cl - ex * bl) * d;
+    double r = x * x + y * y;
+    return std::isfinite(r) ? r : INF_DIST;
+}
+
+// 三角形外接圆圆心
+inline void circumcenter(double ax, double ay, double bx, double by, double cx, double cy,
+                         double& outX, double& outY) {
+    double dx = bx - ax;
+    double dy = by - ay;
+    double ex = cx - ax;
+    double ey = cy - ay;
+
+    double bl = dx * dx + dy * dy;
+    double cl = ex * ex + ey * ey;
+    double d = 0.5 / (dx * ey - dy * ex);
+
+    outX = ax + (ey * bl - dy * cl) * d;
+    outY = ay + (dx * cl - ex * bl) * d;
+}
+
+// 单调的伪极角，取值[0, 1]，用于凸包哈希
+inline double pseudoAngle(double dx, double dy) {
+    double sum = std::fabs(dx) + std::fabs(dy);
+    if (sum == 0.0) {
+        return 0.0;
+    }
+    double p = dx / sum;
+    return (dy > 0 ? 3 - p : 1 + p) / 4;
+}
+
+/**
+ * @brief 三角剖分的工作状态
+ * @note triangles 每3个元素为一个三角形的顶点；halfedges[e] 为半边 e 的对边（-1表示凸包边）
+ */
+class SweepHull {
+public:
+    SweepHull(const std::vector<double>& xs, const std::vector<double>& ys)
+        : x(xs), y(ys), n(static_cast<int>(xs.size())),
+          hullStart(0), trianglesLen(0), centerX(0.0), centerY(0.0) {
+        int maxTriangles = std::max(2 * n - 5, 0);
+        triangles.assign(static_cast<size_t>(maxTriangles) * 3, 0);
+        halfedges.assign(static_cast<size_t>(maxTriangles) * 3, -1);
+        hashSize = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(n))));
+        if (hashSize < 1) hashSize = 1;
+        hullPrev.assign(n, 0);
+        hullNext.assign(n, 0);
+        hullTri.assign(n, 0);
+        hullHash.assign(hashSize, -1);
+    }
+
+    const std::vector<double>& x;
+    const std::vector<double>& y;
+    int n;
+
+    std::vector<int> triangles;
+    std::vector<int> halfedges;
+    std::vector<int> hullPrev;
+    std::vector<int> hullNext;
+    std::vector<int> hullTri;
+    std::vector<int> hullHash;
+    std::vector<int> edgeStack;
+    int hashSize;
+    int hullStart;
+    int trianglesLen;
+    double centerX;
+    double centerY;
+
+    int hashKey(double px, double py) const {
+        int key = static_cast<int>(std::floor(pseudoAngle(px - centerX, py - centerY) * hashSize));
+        return ((key % hashSize) + hashSize) % hashSize;
+    }
+
+    void link(int a, int b) {
+        halfedges[a] = b;
+        if (b != -1) halfedges[b] = a;
+    }
+
+    int addTriangle(int i0, int i1, int i2, int a, int b, int c) {
+        int t = trianglesLen;
+        triangles[t] = i0;
+        triangles[t + 1] = i1;
+        triangles[t + 2] = i2;
+        link(t, a);
+        link(t + 1, b);
+        link(t + 2, c);
+        trianglesLen += 3;
+        return t;
+    }
+
+    /**
+     * @brief 从半边 a 开始递归翻转不满足Delaunay条件的相邻三角形（显式栈代替递归）
+     * @return 翻转完成后新点所在三角形中指向凸包的半边
+     */
+    int legalize(int a) {
+        int ar = 0;
+        edgeStack.clear();
+
+        while (true) {
+            int b = halfedges[a];
+            int a0 = a - a % 3;
+            ar = a0 + (a + 2) % 3;
+
+            if (b == -1) {
+                // 凸包边，无需翻转
+                if (edgeStack.empty()) break;
+                a = edgeStack.back();
+                edgeStack.pop_back();
+                continue;
+            }
+
+            int b0 = b - b % 3;
+            int al = a0 + (a + 1) % 3;
+            int bl = b0 + (b + 2) % 3;
+
+            int p0 = triangles[ar];
+            int pr = triangles[a];
+            int pl = triangles[al];
+            int p1 = triangles[bl];
+
+            bool illegal = inCircle(x[p0], y[p0], x[pr], y[pr], x[pl], y[pl], x[p1], y[p1]);
+
+            if (illegal) {
+                triangles[a] = p1;
+                triangles[b] = p0;
+
+                int hbl = halfedges[bl];
+
+                // 翻转的边位于凸包另一侧（罕见），修正凸包三角形引用
+                if (hbl == -1) {
+                    int e = hullStart;
+                    do {
+                        if (hullTri[e] == bl) {
+                            hullTri[e] = a;
+                            break;
+                        }
+                        e = hullPrev[e];
+                    } while (e != hullStart);
+                }
+                link(a, hbl);
+                link(b, halfedges[ar]);
+                link(ar, bl);
+
+                int br = b0 + (b + 1) % 3;
+                edgeStack.push_back(br);
+            }
+            else {
+                if (edgeStack.empty()) break;
+                a = edgeStack.back();
+                edgeStack.pop_back();
+            }
+        }
+
+        return ar;
+    }
+};
+
+} // namespace
+
+/**
+ * @brief 计算点集的Delaunay三角剖分边
+ * @note 先按坐标排序去除重合点（重合点以零长度边挂到代表点上），再对互异点剖分
+ */
+int Delaunay::triangulateEdges(const double* xs, const double* ys, int n,
+                               std::vector<std::pair<int, int>>& edges) {
+    edges.clear();
+    if (xs == nullptr || ys == nullptr || n <= 1) {
+        return 0;
+    }
+
+    // 按(x, y)排序以识别重合点
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [xs, ys](int a, int b) {
+        if (xs[a] != xs[b]) return xs[a] < xs[b];
+        if (ys[a] != ys[b]) return ys[a] < ys[b];
+        return a < b;
+    });
+
+    std::vector<double> uniqueX;
+    std::vector<double> uniqueY;
+    std::vector<int> uniqueToOrig;
+    uniqueX.reserve(n);
+    uniqueY.reserve(n);
+    uniqueToOrig.reserve(n);
+
+    for (int k = 0; k < n; k++) {
+        int idx = order[k];
+        if (!uniqueToOrig.empty()) {
+            int rep = uniqueToOrig.back();
+            if (xs[idx] == xs[rep] && ys[idx] == ys[rep]) {
+                // 重合点：与代表点以零长度边相连
+                edges.emplace_back(std::min(rep, idx), std::max(rep, idx));
+                continue;
+            }
+        }
+        uniqueX.push_back(xs[idx]);
+        uniqueY.push_back(ys[idx]);
+        uniqueToOrig.push_back(idx);
+    }
+
+    std::vector<std::pair<int, int>> uniqueEdges;
+    triangulateUnique(uniqueX, uniqueY, uniqueEdges);
+
+    // 将去重后的下标映射回原始下标
+    for (const auto& e : uniqueEdges) {
+        int u = uniqueToOrig[e.first];
+        int v = uniqueToOrig[e.second];
+        edges.emplace_back(std::min(u, v), std::max(u, v));
+    }
+
+    return static_cast<int>(edges.size());
+}
+
+/**
+ * @brief 对互不重合的点进行三角剖分
+ */
+void Delaunay::triangulateUnique(const std::vector<double>& xs, const std::vector<double>& ys,
+                                 std::vector<std::pair<int, int>>& edges) {
+    int n = static_cast<int>(xs.size());
+    if (n < 2) {
+        return;
+    }
+    if (n == 2) {
+        edges.emplace_back(0, 1);
+        return;
+    }
+
+    // 包围盒中心
+    double minX = INF_DIST, minY = INF_DIST, maxX = -INF_DIST, maxY = -INF_DIST;
+    for (int i = 0; i < n; i++) {
+        minX = std::min(minX, xs[i]);
+        minY = std::min(minY, ys[i]);
+        maxX = std::max(maxX, xs[i]);
+        maxY = std::max(maxY, ys[i]);
+    }
+    double cx = (minX + maxX) / 2;
+    double cy = (minY + maxY) / 2;
+
+    // 种子点 i0：最靠近中心的点
+    int i0 = 0;
+    double minDist = INF_DIST;
+    for (int i = 0; i < n; i++) {
+        double d = squaredDist(cx, cy, xs[i], ys[i]);
+        if (d < minDist) {
+            i0 = i;
+            minDist = d;
+        }
+    }
+
+    // 种子点 i1：离 i0 最近的点
+    int i1 = -1;
+    minDist = INF_DIST;
+    for (int i = 0; i < n; i++) {
+        if (i == i0) continue;
+        double d = squaredDist(xs[i0], ys[i0], xs[i], ys[i]);
+        if (d < minDist && d > 0) {
+            i1 = i;
+            minDist = d;
+        }
+    }
+
+    // 种子点 i2：与 i0、i1 不共线（精确判定）且构成外接圆最小的点
+    int i2 = -1;
+    bool collinear = true;
+    double minRadius = INF_DIST;
+    for (int i = 0; i < n; i++) {
+        if (i == i0 || i == i1) continue;
+        if (orientSign(xs[i0], ys[i0], xs[i1], ys[i1], xs[i], ys[i]) == 0) continue;
+        collinear = false;
+        double r = circumradius(xs[i0], ys[i0], xs[i1], ys[i1], xs[i], ys[i]);
+        if (r < minRadius) {
+            i2 = i;
+            minRadius = r;
+        }
+    }
+
+    if (collinear) {
+        // 所有点严格共线，退化为链
+        connectCollinear(xs, ys, edges);
+        return;
+    }
+    if (i2 == -1) {
+        // 不共线，但所有候选三角形都扁到外接圆半径在浮点下溢出
+        fallbackEdges(xs, ys, edges);
+        return;
+    }
+
+    // 保证种子三角形为逆时针方向
+    if (orient(xs[i0], ys[i0], xs[i1], ys[i1], xs[i2], ys[i2])) {
+        std::swap(i1, i2);
+    }
+
+    SweepHull h(xs, ys);
+    circumcenter(xs[i0], ys[i0], xs[i1], ys[i1], xs[i2], ys[i2], h.centerX, h.centerY);
+    if (!std::isfinite(h.centerX) || !std::isfinite(h.centerY)) {
+        fallbackEdges(xs, ys, edges);
+        return;
+    }
+
+    // 按到外接圆心的距离排序插入顺序
+    std::vector<double> dists(n);
+    for (int i = 0; i < n; i++) {
+        dists[i] = squaredDist(xs[i], ys[i], h.centerX, h.centerY);
+    }
+    std::vector<int> ids(n);
+    std::iota(ids.begin(), ids.end(), 0);
+    std::sort(ids.begin(), ids.end(), [&dists](int a, int b) {
+        if (dists[a] != dists[b]) return dists[a] < dists[b];
+        return a < b;
+    });
+
+    // 以种子三角形作为初始凸包
+    h.hullStart = i0;
+    h.hullNext[i0] = h.hullPrev[i2] = i1;
+    h.hullNext[i1] = h.hullPrev[i0] = i2;
+    h.hullNext[i2] = h.hullPrev[i1] = i0;
+
+    h.hullTri[i0] = 0;
+    h.hullTri[i1] = 1;
+    h.hullTri[i2] = 2;
+
+    h.hullHash[h.hashKey(xs[i0], ys[i0])] = i0;
+    h.hullHash[h.hashKey(xs[i1], ys[i1])] = i1;
+    h.hullHash[h.hashKey(xs[i2], ys[i2])] = i2;
+
+    h.addTriangle(i0, i1, i2, -1, -1, -1);
+
+    for (int k = 0; k < n; k++) {
+        int i = ids[k];
+        double px = xs[i];
+        double py = ys[i];
+
+        // 跳过种子三角形的顶点
+        if (i == i0 || i == i1 || i == i2) continue;
+
+        // 利用哈希表找到一条可见的凸包边
+        int start = 0;
+        int key = h.hashKey(px, py);
+        for (int j = 0; j < h.hashSize; j++) {
+            start = h.hullHash[(key + j) % h.hashSize];
+            if (start != -1 && start != h.hullNext[start]) break;
+        }
+
+        start = h.hullPrev[start];
+        int e = start;
+        int q = h.hullNext[e];
+        while (!orient(px, py, xs[e], ys[e], xs[q], ys[q])) {
+            e = q;
+            if (e == start) {
+                e = -1;
+                break;
+            }
+            q = h.hullNext[e];
+        }
+        if (e == -1) {
+            // 点落在当前凸包内（种子外接圆内有其他点，或圆心极远时插入顺序的浮点误差），
+            // 扫描凸包无法插入；改用kd树候选边，仍保证包含欧氏最小生成树
+            fallbackEdges(xs, ys, edges);
+            return;
+        }
+
+        // 从该点添加第一个三角形
+        int t = h.addTriangle(e, i, h.hullNext[e], -1, -1, h.hullTri[e]);
+
+        // 递归翻转直到满足Delaunay条件
+        h.hullTri[i] = h.legalize(t + 2);
+        h.hullTri[e] = t;
+
+        // 向前沿凸包扩展
+        int nxt = h.hullNext[e];
+        q = h.hullNext[nxt];
+        while (orient(px, py, xs[nxt], ys[nxt], xs[q], ys[q])) {
+            t = h.addTriangle(nxt, i, q, h.hullTri[i], -1, h.hullTri[nxt]);
+            h.hullTri[i] = h.legalize(t + 2);
+            h.hullNext[nxt] = nxt; // 标记为已移出凸包
+            nxt = q;
+            q = h.hullNext[nxt];
+        }
+
+        // 向后沿凸包扩展
+        if (e == start) {
+            q = h.hullPrev[e];
+            while (orient(px, py, xs[q], ys[q], xs[e], ys[e])) {
+                t = h.addTriangle(q, i, e, -1, h.hullTri[e], h.hullTri[q]);
+                h.legalize(t + 2);
+                h.hullTri[q] = t;
+                h.hullNext[e] = e; // 标记为已移出凸包
+                e = q;
+                q = h.hullPrev[e];
+            }
+        }
+
+        // 更新凸包
+        h.hullStart = h.hullPrev[i] = e;
+        h.hullNext[e] = h.hullPrev[nxt] = i;
+        h.hullNext[i] = nxt;
+
+        h.hullHash[h.hashKey(px, py)] = i;
+        h.hullHash[h.hashKey(xs[e], ys[e])] = e;
+    }
+
+    // 提取无重复边：凸包边（对边为-1）与内部边（只取 e > halfedges[e] 的一侧）
+    edges.reserve(static_cast<size_t>(h.trianglesLen / 2 + n));
+    for (int e = 0; e < h.trianglesLen; e++) {
+        if (e > h.halfedges[e]) {
+            int next = (e % 3 == 2) ? e - 2 : e + 1;
+            edges.emplace_back(h.triangles[e], h.triangles[next]);
+        }
+    }
+}
+
+/**
+ * @brief 严格共线的点集：沿直线的顺序即按(x, y)的字典序（非竖直线上x严格单调），排序后依次相连
+ * @note 只比较坐标，不计算投影，不引入舍入误差
+ */
+void Delaunay::connectCollinear(const std::vector<double>& xs, const std::vector<double>& ys,
+                                std::vector<std::pair<int, int>>& edges) {
+    int n = static_cast<int>(xs.size());
+    std::vector<int> ids(n);
+    std::iota(ids.begin(), ids.end(), 0);
+    std::sort(ids.begin(), ids.end(), [&xs, &ys](int a, int b) {
+        if (xs[a] != xs[b]) return xs[a] < xs[b];
+        return ys[a] < ys[b];
+    });
+
+    for (int k = 1; k < n; k++) {
+        edges.emplace_back(ids[k - 1], ids[k]);
+    }
+}
+
+/**
+ * @brief 扫描凸包无法完成时的精确替代：kd树k近邻边 + 逐轮最近异分量边
+ */
+void Delaunay::fallbackEdges(const std::vector<double>& xs, const std::vector<double>& ys,
+                             std::vector<std::pair<int, int>>& edges) {
+    KdTree::candidateEdges(xs.data(), ys.data(), static_cast<int>(xs.size()), FALLBACK_NEIGHBORS, edges);
+}
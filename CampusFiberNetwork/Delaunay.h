@@ -0,0 +1,53 @@
+/**
+ * @file Delaunay.h
+ * @brief 平面点集Delaunay三角剖分，用于生成欧氏最小生成树的候选边
+ * @class Delaunay
+ * @brief 基于扫描凸包（sweep-hull）+ 边翻转的增量式三角剖分
+ *
+ * 欧氏最小生成树必然是Delaunay三角剖分的子图，而三角剖分只有O(n)条边，
+ * 因此对这些候选边运行Kruskal即可在O(n log n)内得到与完全图相同的最小生成树。
+ * 几何判定均为精确谓词；扫描凸包在极端退化输入上无法插入某点时，整体改用kd树候选边（同样精确）。
+ */
+
+#ifndef DELAUNAY_H
+#define DELAUNAY_H
+
+#include <utility>
+#include <vector>
+
+class Delaunay {
+public:
+    /**
+     * @brief 计算点集的Delaunay三角剖分边
+     * @param xs 点的X坐标数组
+     * @param ys 点的Y坐标数组
+     * @param n 点的数量
+     * @param edges 输出：无重复的边（顶点下标对，first < second）
+     * @return 输出的边数
+     * @note 重合点先合并，再以零长度边挂回代表点；全部严格共线时退化为按直线顺序相连的链，
+     *       保证输出的边集总是包含该点集的一棵欧氏最小生成树
+     */
+    static int triangulateEdges(const double* xs, const double* ys, int n,
+                                std::vector<std::pair<int, int>>& edges);
+
+private:
+    /**
+     * @brief 对互不重合的点进行三角剖分，输出边（下标相对于传入数组）
+     */
+    static void triangulateUnique(const std::vector<double>& xs, const std::vector<double>& ys,
+                                  std::vector<std::pair<int, int>>& edges);
+
+    /**
+     * @brief 共线点集的退化处理：沿直线方向排序后依次连边
+     */
+    static void connectCollinear(const std::vector<double>& xs, const std::vector<double>& ys,
+                                 std::vector<std::pair<int, int>>& edges);
+
+    /**
+     * @brief 扫描凸包无法完成时改用kd树候选边（替换已输出的边）
+     */
+    static void fallbackEdges(const std::vector<double>& xs, const std::vector<double>& ys,
+                              std::vector<std::pair<int, int>>& edges);
+};
+
+#endif // DELAUNAY_H
@@ -0,0 +1,125 @@
+/**
+ * @file DistanceKernel.cpp
+ * @brief 批量欧氏距离计算的SIMD实现与运行时分派
+ */
+
+#include "DistanceKernel.h"
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CFN_DISTANCE_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC/Clang需按函数开启指令集，其余文件不受影响；MSVC无需开启即可使用内建函数
+#if defined(CFN_DISTANCE_X86) && (defined(__GNUC__) || defined(__clang__))
+#define CFN_TARGET_AVX __attribute__((target("avx")))
+#define CFN_TARGET_SSE2 __attribute__((target("sse2")))
+#else
+#define CFN_TARGET_AVX
+#define CFN_TARGET_SSE2
+#endif
+
+namespace {
+
+typedef void (*RowFunction)(double, double, const double*, const double*, int, double*);
+
+void distanceRowScalar(double x, double y, const double* xs, const double* ys, int n, double* out) {
+    for (int k = 0; k < n; k++) {
+        double dx = xs[k] - x;
+        double dy = ys[k] - y;
+        out[k] = std::sqrt(dx * dx + dy * dy);
+    }
+}
+
+#ifdef CFN_DISTANCE_X86
+
+CFN_TARGET_SSE2
+void distanceRowSse2(double x, double y, const double* xs, const double* ys, int n, double* out) {
+    const __m128d px = _mm_set1_pd(x);
+    const __m128d py = _mm_set1_pd(y);
+    int k = 0;
+    for (; k + 2 <= n; k += 2) {
+        __m128d dx = _mm_sub_pd(_mm_loadu_pd(xs + k), px);
+        __m128d dy = _mm_sub_pd(_mm_loadu_pd(ys + k), py);
+        __m128d sq = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+        _mm_storeu_pd(out + k, _mm_sqrt_pd(sq));
+    }
+    distanceRowScalar(x, y, xs + k, ys + k, n - k, out + k);
+}
+
+CFN_TARGET_AVX
+void distanceRowAvx(double x, double y, const double* xs, const double* ys, int n, double* out) {
+    const __m256d px = _mm256_set1_pd(x);
+    const __m256d py = _mm256_set1_pd(y);
+    int k = 0;
+    for (; k + 4 <= n; k += 4) {
+        __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(xs + k), px);
+        __m256d dy = _mm256_sub_pd(_mm256_loadu_pd(ys + k), py);
+        __m256d sq = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+        _mm256_storeu_pd(out + k, _mm256_sqrt_pd(sq));
+    }
+    // 避免AVX与SSE指令切换的性能损失
+    _mm256_zeroupper();
+    distanceRowScalar(x, y, xs + k, ys + k, n - k, out + k);
+}
+
+// CPU与操作系统是否支持AVX（需OSXSAVE且XCR0启用了XMM/YMM状态保存）
+bool cpuHasAvx() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+#else
+    return __builtin_cpu_supports("avx");
+#endif
+}
+
+bool cpuHasSse2() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(_MSC_VER)
+    return true; // x86-64的基线指令集；MSVC默认以/arch:SSE2编译
+#else
+    return __builtin_cpu_supports("sse2");
+#endif
+}
+
+#endif // CFN_DISTANCE_X86
+
+struct Dispatch {
+    RowFunction row;
+    const char* name;
+};
+
+// 首次调用时检测CPU并选定实现（局部静态变量的初始化是线程安全的）
+const Dispatch& dispatch() {
+    static const Dispatch selected = [] {
+#ifdef CFN_DISTANCE_X86
+        if (cpuHasAvx()) {
+            return Dispatch{ distanceRowAvx, "AVX" };
+        }
+        if (cpuHasSse2()) {
+            return Dispatch{ distanceRowSse2, "SSE2" };
+        }
+#endif
+        return Dispatch{ distanceRowScalar, "scalar" };
+    }();
+    return selected;
+}
+
+} // namespace
+
+void DistanceKernel::distanceRow(double x, double y, const double* xs, const double* ys, int n, double* out) {
+    if (n <= 0) {
+        return;
+    }
+    dispatch().row(x, y, xs, ys, n, out);
+}
+
+const char* DistanceKernel::instructionSet() {
+    return dispatch().name;
+}
@@ -0,0 +1,34 @@
+/**
+ * @file DistanceKernel.h
+ * @brief 一点到一组点的欧氏距离批量计算（SIMD）
+ * @class DistanceKernel
+ * @brief 对连续存储的SoA坐标一次求出一整行距离，运行时按CPU选择AVX、SSE2或标量实现
+ *
+ * 完全图建边时每个节点都要与其后所有节点求距离，是建图最热的循环。
+ * 坐标有效性在调用前统一校验，核心循环内没有分支，AVX每次处理4个点、SSE2每次2个点。
+ * 各实现均按(dx*dx + dy*dy)先乘后加再开方（IEEE开方正确舍入），
+ * 未启用FMA编译选项时结果与calDistance逐位相同，距离转权重的结果不受所选实现影响。
+ */
+
+#ifndef DISTANCE_KERNEL_H
+#define DISTANCE_KERNEL_H
+
+class DistanceKernel {
+public:
+    /**
+     * @brief 计算点(x, y)到n个点的欧氏距离
+     * @param x 起点X坐标
+     * @param y 起点Y坐标
+     * @param xs 目标点X坐标数组（连续存储，无需对齐）
+     * @param ys 目标点Y坐标数组
+     * @param n 目标点数
+     * @param out 输出：out[k]为到(xs[k], ys[k])的距离，可与输入不重叠的任意数组
+     * @note 调用方保证坐标均为有限值
+     */
+    static void distanceRow(double x, double y, const double* xs, const double* ys, int n, double* out);
+
+    // 当前使用的实现名称（"AVX"、"SSE2"或"scalar"），用于日志与基准测试
+    static const char* instructionSet();
+};
+
+#endif // DISTANCE_KERNEL_H
@@ -0,0 +1,712 @@
+/**
+ * @file DynamicMST.cpp
+ * @brief 边权变化下的动态最小生成树实现文件
+ */
+
+#include "DynamicMST.h"
+#include "Graph.h"
+#include "UnionFind.h"
+#include "Logger.h"
+#include <algorithm>
+#include <iostream>
+
+template <typename W>
+BasicDynamicMST<W>::BasicDynamicMST(GraphType& graph)
+    : graph(graph), vertices(graph.getVertices()), maxLevels(1), totalWeight(0), treeEdgeCount(0),
+      promoted(EdgeOrder(&graph)) {
+    // 第i层的树至多V/2^i个顶点，层号不会达到floor(log2 V)+1
+    while ((1LL << maxLevels) <= vertices) {
+        maxLevels++;
+    }
+    levels.reserve(maxLevels);
+    int nodeCount = 2 * vertices - 1;
+    left.assign(nodeCount, -1);
+    right.assign(nodeCount, -1);
+    parent.assign(nodeCount, -1);
+    flipped.assign(nodeCount, 0);
+    value.assign(nodeCount, -1);
+    heaviest.assign(nodeCount, -1);
+    for (int slot = vertices - 2; slot >= 0; slot--) {
+        freeSlots.push_back(slot);
+    }
+
+    // 初始最小生成森林：按edgeLess排序后Kruskal，所有边从第0层开始
+    int edgeCount = graph.getEdgeCount();
+    const EdgeType* edges = graph.getEdges();
+    std::vector<int> order(edgeCount);
+    for (int i = 0; i < edgeCount; i++) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [edges](int a, int b) {
+        return GraphType::edgeLess(edges[a], edges[b]);
+    });
+
+    edgeSlot.assign(edgeCount, -1);
+    edgeLevel.assign(edgeCount, 0);
+    treePos.assign(2 * edgeCount, -1);
+    EulerLevel& base = level(0);
+    UnionFind uf(vertices);
+    for (int idx : order) {
+        int u = edges[idx].getSrc();
+        int v = edges[idx].getDest();
+        if (uf.find(u) != uf.find(v)) {
+            uf.unite(u, v);
+            linkTreeEdge(idx, 0);
+        }
+    }
+    // 非树边按edgeLess顺序插入，每次都在集合末尾，带提示插入为均摊O(1)；最后统一刷新聚合值
+    for (int idx : order) {
+        if (edgeSlot[idx] < 0) {
+            EdgeSet& srcSet = base.nonTree[edges[idx].getSrc()];
+            EdgeSet& destSet = base.nonTree[edges[idx].getDest()];
+            srcSet.insert(srcSet.end(), idx);
+            destSet.insert(destSet.end(), idx);
+        }
+    }
+    for (int v = 0; v < vertices; v++) {
+        refreshVertex(base, v);
+    }
+
+    LOG_SUMMARY("动态最小生成树初始化完成：树边 " << treeEdgeCount
+        << "，非树边 " << (edgeCount - treeEdgeCount) << "，总权重 " << totalWeight);
+}
+
+// 按edgeLess取较重的边，-1视为最轻
+template <typename W>
+int BasicDynamicMST<W>::heavier(int a, int b) const {
+    if (a < 0) return b;
+    if (b < 0) return a;
+    const EdgeType* edges = graph.getEdges();
+    return GraphType::edgeLess(edges[a], edges[b]) ? b : a;
+}
+
+// 按edgeLess取较轻的边，-1视为不存在
+template <typename W>
+int BasicDynamicMST<W>::lighter(int a, int b) const {
+    if (a < 0) return b;
+    if (b < 0) return a;
+    const EdgeType* edges = graph.getEdges();
+    return GraphType::edgeLess(edges[a], edges[b]) ? a : b;
+}
+
+// x是否为所在splay树的根（父指针为空或只是路径父指针）
+template <typename W>
+bool BasicDynamicMST<W>::isSplayRoot(int x) const {
+    int p = parent[x];
+    return p < 0 || (left[p] != x && right[p] != x);
+}
+
+template <typename W>
+void BasicDynamicMST<W>::pushDown(int x) {
+    if (flipped[x]) {
+        std::swap(left[x], right[x]);
+        if (left[x] >= 0) flipped[left[x]] ^= 1;
+        if (right[x] >= 0) flipped[right[x]] ^= 1;
+        flipped[x] = 0;
+    }
+}
+
+template <typename W>
+void BasicDynamicMST<W>::pull(int x) {
+    int best = value[x];
+    if (left[x] >= 0) best = heavier(best, heaviest[left[x]]);
+    if (right[x] >= 0) best = heavier(best, heaviest[right[x]]);
+    heaviest[x] = best;
+}
+
+template <typename W>
+void BasicDynamicMST<W>::rotate(int x) {
+    int p = parent[x];
+    int g = parent[p];
+    bool pIsRoot = isSplayRoot(p);
+    if (left[p] == x) {
+        left[p] = right[x];
+        if (right[x] >= 0) parent[right[x]] = p;
+        right[x] = p;
+    }
+    else {
+        right[p] = left[x];
+        if (left[x] >= 0) parent[left[x]] = p;
+        left[x] = p;
+    }
+    parent[p] = x;
+    parent[x] = g;
+    if (!pIsRoot) {
+        if (left[g] == p) left[g] = x;
+        else right[g] = x;
+    }
+    pull(p);
+    pull(x);
+}
+
+template <typename W>
+void BasicDynamicMST<W>::splay(int x) {
+    // 自顶向下下推懒标记
+    splayPath.clear();
+    for (int y = x;; y = parent[y]) {
+        splayPath.push_back(y);
+        if (isSplayRoot(y)) break;
+    }
+    for (auto it = splayPath.rbegin(); it != splayPath.rend(); ++it) {
+        pushDown(*it);
+    }
+
+    while (!isSplayRoot(x)) {
+        int p = parent[x];
+        if (!isSplayRoot(p)) {
+            int g = parent[p];
+            bool zigZig = (left[g] == p) == (left[p] == x);
+            rotate(zigZig ? p : x);
+        }
+        rotate(x);
+    }
+}
+
+// 使根到x的路径成为一条偏好路径，x为其splay树的根
+template <typename W>
+void BasicDynamicMST<W>::access(int x) {
+    int last = -1;
+    for (int y = x; y >= 0; y = parent[y]) {
+        splay(y);
+        right[y] = last;
+        pull(y);
+        last = y;
+    }
+    splay(x);
+}
+
+template <typename W>
+void BasicDynamicMST<W>::makeRoot(int x) {
+    access(x);
+    flipped[x] ^= 1;
+}
+
+template <typename W>
+int BasicDynamicMST<W>::findRoot(int x) {
+    access(x);
+    while (true) {
+        pushDown(x);
+        if (left[x] < 0) break;
+        x = left[x];
+    }
+    splay(x);
+    return x;
+}
+
+template <typename W>
+void BasicDynamicMST<W>::link(int x, int y) {
+    makeRoot(x);
+    parent[x] = y;
+}
+
+template <typename W>
+void BasicDynamicMST<W>::cut(int x, int y) {
+    makeRoot(x);
+    access(y);
+    // 此时路径仅为x - y，x为y的左孩子
+    left[y] = -1;
+    parent[x] = -1;
+    pull(y);
+}
+
+// 取得第i层，首次使用时创建（各顶点为单独的一棵树）
+template <typename W>
+typename BasicDynamicMST<W>::EulerLevel& BasicDynamicMST<W>::level(int i) {
+    while (static_cast<int>(levels.size()) <= i) {
+        levels.emplace_back();
+        EulerLevel& t = levels.back();
+        int nodeCount = 3 * vertices - 2;
+        t.left.assign(nodeCount, -1);
+        t.right.assign(nodeCount, -1);
+        t.parent.assign(nodeCount, -1);
+        t.vertexCount.assign(nodeCount, 0);
+        std::fill(t.vertexCount.begin(), t.vertexCount.begin() + vertices, 1);
+        t.lightest.assign(nodeCount, -1);
+        t.hasTree.assign(nodeCount, 0);
+        t.nonTree.assign(vertices, EdgeSet(EdgeOrder(&graph)));
+        t.treeEdges.assign(vertices, std::vector<int>());
+    }
+    return levels[i];
+}
+
+template <typename W>
+void BasicDynamicMST<W>::tourPull(EulerLevel& t, int x) {
+    int count = 0;
+    int best = -1;
+    char tree = 0;
+    if (x < vertices) {
+        count = 1;
+        if (!t.nonTree[x].empty()) best = *t.nonTree[x].begin();
+        tree = !t.treeEdges[x].empty();
+    }
+    for (int child : { t.left[x], t.right[x] }) {
+        if (child >= 0) {
+            count += t.vertexCount[child];
+            best = lighter(best, t.lightest[child]);
+            tree |= t.hasTree[child];
+        }
+    }
+    t.vertexCount[x] = count;
+    t.lightest[x] = best;
+    t.hasTree[x] = tree;
+}
+
+template <typename W>
+void BasicDynamicMST<W>::tourRotate(EulerLevel& t, int x) {
+    int p = t.parent[x];
+    int g = t.parent[p];
+    if (t.left[p] == x) {
+        t.left[p] = t.right[x];
+        if (t.right[x] >= 0) t.parent[t.right[x]] = p;
+        t.right[x] = p;
+    }
+    else {
+        t.right[p] = t.left[x];
+        if (t.left[x] >= 0) t.parent[t.left[x]] = p;
+        t.left[x] = p;
+    }
+    t.parent[p] = x;
+    t.parent[x] = g;
+    if (g >= 0) {
+        if (t.left[g] == p) t.left[g] = x;
+        else t.right[g] = x;
+    }
+    tourPull(t, p);
+    tourPull(t, x);
+}
+
+template <typename W>
+void BasicDynamicMST<W>::tourSplay(EulerLevel& t, int x) {
+    while (t.parent[x] >= 0) {
+        int p = t.parent[x];
+        int g = t.parent[p];
+        if (g >= 0) {
+            bool zigZig = (t.left[g] == p) == (t.left[p] == x);
+            tourRotate(t, zigZig ? p : x);
+        }
+        tourRotate(t, x);
+    }
+}
+
+// 把以a、b为根的两段回路序列首尾相接，返回新的根（任一段可为-1）
+template <typename W>
+int BasicDynamicMST<W>::tourJoin(EulerLevel& t, int a, int b) {
+    if (a < 0) return b;
+    if (b < 0) return a;
+    int x = a;
+    while (t.right[x] >= 0) {
+        x = t.right[x];
+    }
+    tourSplay(t, x);
+    t.right[x] = b;
+    t.parent[b] = x;
+    tourPull(t, x);
+    return x;
+}
+
+// 轮换回路序列使顶点v位于开头，此后v为splay根且没有左子树
+template <typename W>
+void BasicDynamicMST<W>::tourReroot(EulerLevel& t, int v) {
+    tourSplay(t, v);
+    int before = t.left[v];
+    if (before >= 0) {
+        t.left[v] = -1;
+        t.parent[before] = -1;
+        tourPull(t, v);
+        tourJoin(t, v, before);
+        tourSplay(t, v);
+    }
+}
+
+// 在第t层连接树边：回路为 tour(src) + (src->dest) + tour(dest) + (dest->src)
+template <typename W>
+void BasicDynamicMST<W>::tourLink(EulerLevel& t, int edge) {
+    int forward = vertices + 2 * edgeSlot[edge];
+    int backward = forward + 1;
+    for (int arc : { forward, backward }) {
+        t.left[arc] = t.right[arc] = t.parent[arc] = -1;
+        tourPull(t, arc);
+    }
+    const EdgeType& e = graph.getEdges()[edge];
+    tourReroot(t, e.getSrc());
+    tourReroot(t, e.getDest());
+    int root = tourJoin(t, e.getSrc(), forward);
+    root = tourJoin(t, root, e.getDest());
+    tourJoin(t, root, backward);
+}
+
+// 回路为 A (src->dest) B (dest->src) C（或两条弧顺序相反）时，切断后得到B与C+A两棵树
+template <typename W>
+void BasicDynamicMST<W>::tourCut(EulerLevel& t, int edge) {
+    int forward = vertices + 2 * edgeSlot[edge];
+    int backward = forward + 1;
+    tourSplay(t, forward);
+    int before = t.left[forward];
+    int after = t.right[forward];
+    t.left[forward] = t.right[forward] = -1;
+    if (before >= 0) t.parent[before] = -1;
+    if (after >= 0) t.parent[after] = -1;
+    tourPull(t, forward);
+
+    int top = backward;
+    while (t.parent[top] >= 0) {
+        top = t.parent[top];
+    }
+    tourSplay(t, backward);
+    int innerBefore = t.left[backward];
+    int innerAfter = t.right[backward];
+    t.left[backward] = t.right[backward] = -1;
+    if (innerBefore >= 0) t.parent[innerBefore] = -1;
+    if (innerAfter >= 0) t.parent[innerAfter] = -1;
+    tourPull(t, backward);
+    if (after >= 0 && top == after) {
+        tourJoin(t, before, innerAfter);  // innerBefore单独成树
+    }
+    else {
+        tourJoin(t, innerBefore, after);  // innerAfter单独成树
+    }
+}
+
+template <typename W>
+bool BasicDynamicMST<W>::tourConnected(EulerLevel& t, int a, int b) {
+    if (a == b) {
+        return true;
+    }
+    tourSplay(t, a);
+    int top = b;
+    while (t.parent[top] >= 0) {
+        top = t.parent[top];
+    }
+    tourSplay(t, b);
+    return top == a;
+}
+
+// 顶点自身的非树边集合或树边列表变化后，转到splay根并重算聚合值
+template <typename W>
+void BasicDynamicMST<W>::refreshVertex(EulerLevel& t, int v) {
+    tourSplay(t, v);
+    tourPull(t, v);
+}
+
+template <typename W>
+void BasicDynamicMST<W>::insertNonTree(int edge, int lv) {
+    const EdgeType& e = graph.getEdges()[edge];
+    EulerLevel& t = level(lv);
+    edgeLevel[edge] = lv;
+    for (int endpoint : { e.getSrc(), e.getDest() }) {
+        t.nonTree[endpoint].insert(edge);
+        refreshVertex(t, endpoint);
+    }
+    if (lv > 0) {
+        promoted.insert(edge);
+    }
+}
+
+template <typename W>
+void BasicDynamicMST<W>::eraseNonTree(int edge) {
+    const EdgeType& e = graph.getEdges()[edge];
+    int lv = edgeLevel[edge];
+    EulerLevel& t = levels[lv];
+    for (int endpoint : { e.getSrc(), e.getDest() }) {
+        t.nonTree[endpoint].erase(edge);
+        refreshVertex(t, endpoint);
+    }
+    if (lv > 0) {
+        promoted.erase(edge);
+    }
+}
+
+template <typename W>
+void BasicDynamicMST<W>::addTreeListEntry(int edge, int lv) {
+    const EdgeType& e = graph.getEdges()[edge];
+    EulerLevel& t = level(lv);
+    edgeLevel[edge] = lv;
+    for (int side = 0; side < 2; side++) {
+        int endpoint = side == 0 ? e.getSrc() : e.getDest();
+        treePos[2 * edge + side] = static_cast<int>(t.treeEdges[endpoint].size());
+        t.treeEdges[endpoint].push_back(edge);
+        refreshVertex(t, endpoint);
+    }
+}
+
+template <typename W>
+void BasicDynamicMST<W>::removeTreeListEntry(int edge) {
+    const EdgeType* edges = graph.getEdges();
+    EulerLevel& t = levels[edgeLevel[edge]];
+    for (int side = 0; side < 2; side++) {
+        int endpoint = side == 0 ? edges[edge].getSrc() : edges[edge].getDest();
+        std::vector<int>& list = t.treeEdges[endpoint];
+        int moved = list.back();
+        list[treePos[2 * edge + side]] = moved;
+        treePos[2 * moved + (edges[moved].getSrc() == endpoint ? 0 : 1)] = treePos[2 * edge + side];
+        list.pop_back();
+        refreshVertex(t, endpoint);
+    }
+}
+
+template <typename W>
+void BasicDynamicMST<W>::linkTreeEdge(int edge, int lv) {
+    int slot = freeSlots.back();
+    freeSlots.pop_back();
+    int node = vertices + slot;
+    left[node] = right[node] = parent[node] = -1;
+    flipped[node] = 0;
+    value[node] = heaviest[node] = edge;
+    edgeSlot[edge] = slot;
+
+    const EdgeType& e = graph.getEdges()[edge];
+    link(node, e.getSrc());
+    link(node, e.getDest());
+    for (int i = 0; i <= lv; i++) {
+        tourLink(level(i), edge);
+    }
+    addTreeListEntry(edge, lv);
+    if (lv > 0) {
+        promoted.insert(edge);
+    }
+    totalWeight += e.getWeight();
+    treeEdgeCount++;
+}
+
+// 从Link-Cut树与各层回路中切断树边；层号保留，由调用方决定放回的层
+template <typename W>
+void BasicDynamicMST<W>::cutTreeEdge(int edge) {
+    int node = vertices + edgeSlot[edge];
+    const EdgeType& e = graph.getEdges()[edge];
+    cut(node, e.getSrc());
+    cut(node, e.getDest());
+    int lv = edgeLevel[edge];
+    for (int i = 0; i <= lv; i++) {
+        tourCut(levels[i], edge);
+    }
+    removeTreeListEntry(edge);
+    if (lv > 0) {
+        promoted.erase(edge);
+    }
+    freeSlots.push_back(edgeSlot[edge]);
+    edgeSlot[edge] = -1;
+    totalWeight -= e.getWeight();
+    treeEdgeCount--;
+}
+
+// 树边升一层：加入上一层的回路（两端在上一层中尚不连通）
+template <typename W>
+void BasicDynamicMST<W>::promoteTreeEdge(int edge) {
+    int lv = edgeLevel[edge];
+    removeTreeListEntry(edge);
+    tourLink(level(lv + 1), edge);
+    addTreeListEntry(edge, lv + 1);
+    if (lv == 0) {
+        promoted.insert(edge);
+    }
+}
+
+template <typename W>
+void BasicDynamicMST<W>::promoteNonTree(int edge) {
+    int lv = edgeLevel[edge];
+    eraseNonTree(edge);
+    insertNonTree(edge, lv + 1);
+}
+
+// 边降回第0层：树边从第1层及以上的回路中切断
+template <typename W>
+void BasicDynamicMST<W>::demoteEdge(int edge) {
+    int lv = edgeLevel[edge];
+    if (edgeSlot[edge] >= 0) {
+        for (int i = lv; i > 0; i--) {
+            tourCut(levels[i], edge);
+        }
+        removeTreeListEntry(edge);
+        addTreeListEntry(edge, 0);
+        promoted.erase(edge);
+    }
+    else {
+        eraseNonTree(edge);
+        insertNonTree(edge, 0);
+    }
+}
+
+/**
+ * @brief 把按edgeLess重于bound的已提升边全部降回第0层
+ * @note 之后以第0层写入权重为bound的边不会破坏“回路上最重的边层号最低”：经过该边的回路上
+ *       比它重的边都在第0层；被降级的集合对“更重”封闭，其余回路的层号关系也不受影响
+ */
+template <typename W>
+void BasicDynamicMST<W>::demoteHeavierThan(const EdgeType& bound) {
+    while (true) {
+        auto it = promoted.upper_bound(bound);
+        if (it == promoted.end()) {
+            break;
+        }
+        demoteEdge(*it);
+    }
+}
+
+// u、v之间树路径上最重的边；不连通时返回-1
+template <typename W>
+int BasicDynamicMST<W>::pathHeaviest(int u, int v) {
+    makeRoot(u);
+    if (findRoot(v) != u) {
+        return -1;
+    }
+    access(v);
+    return heaviest[v];
+}
+
+/**
+ * @brief 切断层号为fromLevel的树边u-v后寻找最轻的跨越边（不加入树）
+ * @param foundLevel 输出找到的边所在的层
+ * @return 替换边下标，两侧之间没有非树边时返回-1
+ * @note 逐层向下：在第i层取较小侧S，S的第i层树边与内部非树边都提升一层，第一条跨越边
+ *       即为全局最轻的跨越边（层号更高的跨越边在之前的层已找过，层号更低的都更重）
+ */
+template <typename W>
+int BasicDynamicMST<W>::findReplacement(int u, int v, int fromLevel, int& foundLevel) {
+    const EdgeType* edges = graph.getEdges();
+    long long promotedCount = 0;
+    for (int i = fromLevel; i >= 0; i--) {
+        EulerLevel& t = levels[i];
+        tourSplay(t, u);
+        int sizeU = t.vertexCount[u];
+        tourSplay(t, v);
+        int sizeV = t.vertexCount[v];
+        int s = sizeU <= sizeV ? u : v;
+
+        // S至多V/2^(i+1)个顶点，其第i层树边可提升一层
+        while (true) {
+            tourSplay(t, s);
+            if (!t.hasTree[s]) {
+                break;
+            }
+            int x = s;
+            while (true) {
+                int l = t.left[x];
+                if (l >= 0 && t.hasTree[l]) {
+                    x = l;
+                }
+                else if (x < vertices && !t.treeEdges[x].empty()) {
+                    break;
+                }
+                else {
+                    x = t.right[x];
+                }
+            }
+            promoteTreeEdge(t.treeEdges[x].back());
+            promotedCount++;
+        }
+
+        // 按edgeLess从轻到重取S的第i层非树边
+        while (true) {
+            tourSplay(t, s);
+            int edge = t.lightest[s];
+            if (edge < 0) {
+                break;
+            }
+            if (!tourConnected(t, edges[edge].getSrc(), edges[edge].getDest())) {
+                LOG_TRACE("寻找替换边：第 " << i << " 层找到，提升 " << promotedCount << " 条边");
+                foundLevel = i;
+                return edge;
+            }
+            promoteNonTree(edge);
+            promotedCount++;
+        }
+    }
+    LOG_TRACE("寻找替换边：无跨越边，提升 " << promotedCount << " 条边");
+    return -1;
+}
+
+// 以第0层放回刚写入新权重的边：先降级更重的已提升边，再与树路径上的最重边比较
+template <typename W>
+void BasicDynamicMST<W>::placeEdge(int edge) {
+    const EdgeType* edges = graph.getEdges();
+    demoteHeavierThan(edges[edge]);
+    int heaviestOnPath = pathHeaviest(edges[edge].getSrc(), edges[edge].getDest());
+    if (heaviestOnPath < 0) {
+        linkTreeEdge(edge, 0);
+    }
+    else if (GraphType::edgeLess(edges[edge], edges[heaviestOnPath])) {
+        // 被替换的边重于新边，已在第0层
+        cutTreeEdge(heaviestOnPath);
+        insertNonTree(heaviestOnPath, 0);
+        linkTreeEdge(edge, 0);
+    }
+    else {
+        insertNonTree(edge, 0);
+    }
+}
+
+template <typename W>
+bool BasicDynamicMST<W>::updateEdgeWeight(int u, int v, W weight) {
+    if (u < 0 || u >= vertices || v < 0 || v >= vertices || u == v) {
+        std::cerr << "错误：无效的边 (" << u << ", " << v << ")" << std::endl;
+        return false;
+    }
+
+    int edge = graph.findEdge(u, v);
+    if (edge < 0) {
+        // 新边视为从无穷大变轻的非树边
+        graph.addEdge(u, v, weight);
+        edge = graph.findEdge(u, v);
+        edgeSlot.resize(graph.getEdgeCount(), -1);
+        edgeLevel.resize(graph.getEdgeCount(), 0);
+        treePos.resize(2 * graph.getEdgeCount(), -1);
+        placeEdge(edge);
+        return true;
+    }
+
+    W oldWeight = graph.getEdges()[edge].getWeight();
+    if (edgeSlot[edge] < 0) {
+        // 非树边：变轻时可能替换树路径上的最重边，变重时树不变
+        eraseNonTree(edge);
+        graph.addEdge(u, v, weight);
+        placeEdge(edge);
+        return true;
+    }
+
+    // 树边先切断；变轻时树不变，直接放回
+    int fromLevel = edgeLevel[edge];
+    cutTreeEdge(edge);
+    graph.addEdge(u, v, weight);
+    if (weight > oldWeight) {
+        // 树边变重：在两侧之间找最轻的跨越边，比新权重更轻时替换之
+        int foundLevel = 0;
+        int replacement = findReplacement(u, v, fromLevel, foundLevel);
+        const EdgeType* edges = graph.getEdges();
+        if (replacement >= 0 && GraphType::edgeLess(edges[replacement], edges[edge])) {
+            eraseNonTree(replacement);
+            linkTreeEdge(replacement, foundLevel);
+            demoteHeavierThan(edges[edge]);
+            insertNonTree(edge, 0);
+            return true;
+        }
+    }
+    // 仍为树边：更重的跨越边都被降回第0层，树边以第0层重新连接两侧
+    demoteHeavierThan(graph.getEdges()[edge]);
+    linkTreeEdge(edge, 0);
+    return true;
+}
+
+template <typename W>
+bool BasicDynamicMST<W>::isTreeEdge(int u, int v) const {
+    int edge = graph.findEdge(u, v);
+    return edge >= 0 && edge < static_cast<int>(edgeSlot.size()) && edgeSlot[edge] >= 0;
+}
+
+template <typename W>
+void BasicDynamicMST<W>::getTreeEdges(std::vector<EdgeType>& edges) const {
+    edges.clear();
+    edges.reserve(treeEdgeCount);
+    const EdgeType* all = graph.getEdges();
+    for (int i = 0; i < static_cast<int>(edgeSlot.size()); i++) {
+        if (edgeSlot[i] >= 0) {
+            edges.push_back(all[i]);
+        }
+    }
+    std::sort(edges.begin(), edges.end(), GraphType::edgeLess);
+}
+
+// 显式实例化：与BasicGraph相同的四种边权类型
+template class BasicDynamicMST<int>;
+template class BasicDynamicMST<long long>;
+template class BasicDynamicMST<float>;
+template class BasicDynamicMST<double>;
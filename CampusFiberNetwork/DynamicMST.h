@@ -0,0 +1,167 @@
+/**
+ * @file DynamicMST.h
+ * @brief 边权变化下的动态最小生成树
+ * @class BasicDynamicMST
+ * @brief 用Link-Cut树维护最小生成森林，逐条修改边权时无需重新运行Kruskal
+ *
+ * 树边以独立的Link-Cut树节点表示（顶点 - 边节点 - 顶点），路径聚合为按BasicGraph::edgeLess
+ * 最重的边，因此可在O(log V)均摊时间内求出两顶点间树路径上的最重边。
+ * 查找替换边采用Holm、de Lichtenberg、Thorup的分层结构：每条边带层号（0起），第i层的
+ * Euler回路树（splay树实现）维护层号>=i的树边构成的森林F_i，节点聚合子树中的顶点数、
+ * 是否有恰为第i层的树边、以及第i层关联非树边中按edgeLess最轻的一条。维持的不变式：
+ * F_i中每棵树至多V/2^i个顶点；第i层非树边的两端在F_i中连通；任一回路上最重的边层号最低。
+ * 四种修改的处理方式：
+ * - 非树边变轻：查询两端树路径上的最重边，新边更轻则替换之；
+ * - 非树边变重、树边变轻：最小生成树不变，只更新权重；
+ * - 树边变重：从该边的层号起逐层向下，在F_i中取切断后较小的一侧S，先把S中第i层树边提升到
+ *   第i+1层，再按edgeLess从轻到重取出S的第i层非树边：两端都在S中的提升一层，第一条跨越
+ *   两侧的即为候选替换边，与该边的新权重比较后取较轻者（可能仍是该边自身）；
+ * - 凡是写入新权重，先把比新权重重的已提升边降回第0层（demote），再以第0层放回该边，
+ *   从而保持“回路上最重的边层号最低”。
+ * 层号至多log V，每次提升O(log V)，故一条边在两次降级之间的提升总耗时为O(log² V)，
+ * 查找替换边均摊O(log² V)；降级的耗时不超过之前对应提升的耗时。
+ * 结果与对修改后的图重新运行kruskalMST得到的树完全一致（edgeLess为全序，最小生成树唯一）。
+ * 成员函数在DynamicMST.cpp中实现并对四种边权类型显式实例化。
+ */
+
+#ifndef DYNAMIC_MST_H
+#define DYNAMIC_MST_H
+
+#include "Graph.h"
+#include <set>
+#include <vector>
+
+template <typename W>
+class BasicDynamicMST {
+public:
+    typedef BasicGraph<W> GraphType;
+    typedef typename GraphType::EdgeType EdgeType;
+    typedef typename GraphType::WeightSum WeightSum;
+
+private:
+    // 按edgeLess比较边下标（取图中的当前权重）；也可与边的值比较，用于按旧权重定位
+    struct EdgeOrder {
+        typedef void is_transparent;
+        const GraphType* graph;
+
+        explicit EdgeOrder(const GraphType* g = nullptr) : graph(g) {}
+        bool operator()(int a, int b) const {
+            return GraphType::edgeLess(graph->getEdges()[a], graph->getEdges()[b]);
+        }
+        bool operator()(int a, const EdgeType& b) const {
+            return GraphType::edgeLess(graph->getEdges()[a], b);
+        }
+        bool operator()(const EdgeType& a, int b) const {
+            return GraphType::edgeLess(a, graph->getEdges()[b]);
+        }
+    };
+    typedef std::set<int, EdgeOrder> EdgeSet;
+
+    // 第i层的Euler回路树：节点0..V-1为顶点，V+2s、V+2s+1为槽位s的树边的两个方向
+    struct EulerLevel {
+        std::vector<int> left;         // splay左孩子，-1表示无
+        std::vector<int> right;        // splay右孩子
+        std::vector<int> parent;       // splay父节点
+        std::vector<int> vertexCount;  // 子树中的顶点节点数
+        std::vector<int> lightest;     // 子树中顶点关联的第i层非树边里最轻的一条，无为-1
+        std::vector<char> hasTree;     // 子树中是否有顶点关联恰为第i层的树边
+        std::vector<EdgeSet> nonTree;             // 顶点 -> 第i层非树边（按edgeLess有序）
+        std::vector<std::vector<int>> treeEdges;  // 顶点 -> 恰为第i层的树边
+    };
+
+    GraphType& graph;             // 被维护的图，边权修改同步写入
+    int vertices;                 // 顶点数（构造时固定）
+    int maxLevels;                // 层数上限floor(log2 V)+1
+    WeightSum totalWeight;        // 当前最小生成森林的总权重
+    int treeEdgeCount;            // 当前树边数
+    std::vector<int> edgeSlot;    // 边下标 -> 树边节点槽位，非树边为-1
+    std::vector<int> edgeLevel;   // 边下标 -> 层号
+    std::vector<int> treePos;     // 树边在两端treeEdges中的位置（2*边下标+0为src，+1为dest）
+    std::vector<int> freeSlots;   // 空闲的树边节点槽位
+    std::vector<EulerLevel> levels; // 各层Euler回路树，按需创建（预留maxLevels，引用不失效）
+    EdgeSet promoted;             // 层号>0的边（按edgeLess有序），降级时从重端取出
+
+    // Link-Cut树：节点0..V-1为顶点，V..2V-2为树边槽位
+    std::vector<int> left;        // splay左孩子，-1表示无
+    std::vector<int> right;       // splay右孩子
+    std::vector<int> parent;      // splay父节点或路径父指针
+    std::vector<char> flipped;    // 子树翻转懒标记
+    std::vector<int> value;       // 节点代表的边下标，顶点为-1
+    std::vector<int> heaviest;    // splay子树中最重的边下标，无边为-1
+    std::vector<int> splayPath;   // splay时下推懒标记用的栈（复用内存）
+
+    int heavier(int a, int b) const;
+    int lighter(int a, int b) const;
+    bool isSplayRoot(int x) const;
+    void pushDown(int x);
+    void pull(int x);
+    void rotate(int x);
+    void splay(int x);
+    void access(int x);
+    void makeRoot(int x);
+    int findRoot(int x);
+    void link(int x, int y);
+    void cut(int x, int y);
+
+    // Euler回路树（按层）
+    EulerLevel& level(int i);
+    void tourPull(EulerLevel& t, int x);
+    void tourRotate(EulerLevel& t, int x);
+    void tourSplay(EulerLevel& t, int x);
+    int tourJoin(EulerLevel& t, int a, int b);
+    void tourReroot(EulerLevel& t, int v);
+    void tourLink(EulerLevel& t, int edge);
+    void tourCut(EulerLevel& t, int edge);
+    bool tourConnected(EulerLevel& t, int a, int b);
+    void refreshVertex(EulerLevel& t, int v);
+
+    // 有序集合按当前权重排序：修改权重前须先把边移出（eraseNonTree或cutTreeEdge），改完再放回
+    void insertNonTree(int edge, int lv);
+    void eraseNonTree(int edge);
+    void addTreeListEntry(int edge, int lv);
+    void removeTreeListEntry(int edge);
+    void linkTreeEdge(int edge, int lv);
+    void cutTreeEdge(int edge);
+    void promoteTreeEdge(int edge);
+    void promoteNonTree(int edge);
+    void demoteEdge(int edge);
+    void demoteHeavierThan(const EdgeType& bound);
+    int pathHeaviest(int u, int v);
+    int findReplacement(int u, int v, int fromLevel, int& foundLevel);
+    void placeEdge(int edge);
+
+public:
+    /**
+     * @brief 在图的当前边集上求出最小生成森林并建立Link-Cut树
+     * @param graph 被维护的图；此后应通过updateEdgeWeight修改边权，顶点数不再变化
+     * @note 初始求解按edgeLess排序后Kruskal，O(E log E)
+     */
+    explicit BasicDynamicMST(GraphType& graph);
+
+    /**
+     * @brief 修改边u-v的权重（边不存在时添加），并更新最小生成森林
+     * @param u 一个端点
+     * @param v 另一个端点
+     * @param weight 新权重
+     * @return 参数有效时返回true；顶点越界或自环返回false
+     * @note 不计降级时为O(log V)均摊，树边变重的替换边查找为O(log² V)均摊。
+     *       写入的新权重比已提升的边轻时，这些边降回第0层（耗时由之前的提升支付），
+     *       此后可再次提升；该界是对提升次数的均摊，交替加重与减轻同一批边时不成立
+     */
+    bool updateEdgeWeight(int u, int v, W weight);
+
+    WeightSum getTotalWeight() const { return totalWeight; }
+    int getTreeEdgeCount() const { return treeEdgeCount; }
+    bool isSpanningTree() const { return treeEdgeCount == vertices - 1; }
+    bool isTreeEdge(int u, int v) const;
+
+    /**
+     * @brief 取出当前的树边，按edgeLess排序（与kruskalMST的getMSTEdges()顺序一致）
+     */
+    void getTreeEdges(std::vector<EdgeType>& edges) const;
+};
+
+// 默认的整数边权版本，与Graph对应
+using DynamicMST = BasicDynamicMST<int>;
+
+#endif // DYNAMIC_MST_H
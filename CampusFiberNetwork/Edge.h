@@ -1,27 +1,33 @@
 #ifndef EDGE_H
 #define EDGE_H
 
-class Edge {
+// ʺͷļֵʽ洢MSTѭпֱչ
+// ȨWWeightTraits.hintlong longfloatdouble
+template <typename W>
+class BasicEdge {
 private:
     int src;    // Դ
     int dest;   // Ŀ궥
-    int weight; // Ȩ
+    W weight;   // Ȩ
 
 public:
     // 캯
-    Edge(int s = 0, int d = 0, int w = 0);
+    BasicEdge(int s = 0, int d = 0, W w = W()) : src(s), dest(d), weight(w) {}
 
     // ȡԴ
-    int getSrc() const;
+    int getSrc() const { return src; }
 
     // ȡĿ궥
-    int getDest() const;
+    int getDest() const { return dest; }
 
     // ȡȨ
-    int getWeight() const;
+    W getWeight() const { return weight; }
 
     // ñȨ
-    void setWeight(int w);
+    void setWeight(W w) { weight = w; }
 };
 
+// ĬϵȨ
+using Edge = BasicEdge<int>;
+
 #endif
\ No newline at end of file
@@ -0,0 +1,90 @@
+/**
+ * @file EdgeIndex.cpp
+ * @brief 无向边哈希索引实现文件
+ */
+
+#include "EdgeIndex.h"
+#include <algorithm>
+
+EdgeIndex::EdgeIndex() : count(0), shift(64), triangleVertices(0) {
+}
+
+/**
+ * @brief 扩容并重新插入已有键
+ * @param minCapacity 期望的最小槽数，向上取整为2的幂（至少16）
+ */
+void EdgeIndex::rehash(std::size_t minCapacity) {
+    std::size_t capacity = 16;
+    int bits = 4;
+    while (capacity < minCapacity) {
+        capacity <<= 1;
+        bits++;
+    }
+    if (capacity <= keys.size()) {
+        return;
+    }
+
+    std::vector<uint64_t> oldKeys;
+    std::vector<int> oldValues;
+    oldKeys.swap(keys);
+    oldValues.swap(values);
+
+    keys.assign(capacity, EMPTY_KEY);
+    values.assign(capacity, -1);
+    shift = 64 - bits;
+
+    std::size_t mask = capacity - 1;
+    for (std::size_t i = 0; i < oldKeys.size(); ++i) {
+        if (oldKeys[i] == EMPTY_KEY) continue;
+        std::size_t slot = slotOf(oldKeys[i]);
+        while (keys[slot] != EMPTY_KEY) {
+            slot = (slot + 1) & mask;
+        }
+        keys[slot] = oldKeys[i];
+        values[slot] = oldValues[i];
+    }
+}
+
+void EdgeIndex::insert(int u, int v, int index) {
+    // 保持装载因子不超过1/2，线性探测的期望探测长度为常数
+    if (static_cast<std::size_t>(count + 1) * 2 > keys.size()) {
+        rehash(std::max<std::size_t>(16, keys.size() * 2));
+    }
+
+    uint64_t key = makeKey(u, v);
+    std::size_t mask = keys.size() - 1;
+    std::size_t slot = slotOf(key);
+    while (keys[slot] != EMPTY_KEY) {
+        if (keys[slot] == key) {
+            values[slot] = index;
+            return;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    keys[slot] = key;
+    values[slot] = index;
+    count++;
+}
+
+void EdgeIndex::reserve(int n) {
+    if (n > 0) {
+        rehash(static_cast<std::size_t>(n) * 2);
+    }
+}
+
+void EdgeIndex::setTriangle(const int* vertexIds, int m, int vertexCount) {
+    triangleRank.assign(vertexCount, -1);
+    for (int a = 0; a < m; a++) {
+        triangleRank[vertexIds[a]] = a;
+    }
+    triangleVertices = m;
+}
+
+void EdgeIndex::clear() {
+    std::fill(keys.begin(), keys.end(), EMPTY_KEY);
+    std::fill(values.begin(), values.end(), -1);
+    count = 0;
+    triangleRank.clear();
+    triangleVertices = 0;
+}
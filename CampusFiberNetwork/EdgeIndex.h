@@ -0,0 +1,100 @@
+/**
+ * @file EdgeIndex.h
+ * @brief 无向边到边数组下标的哈希索引
+ * @class EdgeIndex
+ * @brief 开放寻址（线性探测）哈希表，键为规范化后的(u<v)顶点对
+ *
+ * Graph::addEdge/hasEdge 通过该索引在均摊O(1)内完成查重与查找，
+ * 避免对全部已有边的线性扫描。边只增不删，因此无需墓碑标记。
+ * 批量生成的完全图边登记为"稠密三角区"：其下标由顶点名次直接算出，不占哈希槽，
+ * 完全图建边时无需逐边插入，索引内存也从O(E)降为O(V)。
+ */
+
+#ifndef EDGE_INDEX_H
+#define EDGE_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class EdgeIndex {
+private:
+    static constexpr uint64_t EMPTY_KEY = ~0ULL; // 空槽标记
+
+    std::vector<uint64_t> keys;   // 槽中存放的顶点对键
+    std::vector<int> values;      // 槽中存放的边下标
+    int count;                    // 已存放的键数
+    int shift;                    // 乘法哈希右移位数（64 - log2(容量)）
+    std::vector<int> triangleRank; // 顶点 -> 在稠密三角区中的名次，-1表示不在其中；为空表示没有稠密三角区
+    int triangleVertices;         // 稠密三角区的顶点数m
+
+    // 将(u, v)打包为64位键，调用方保证u < v
+    static uint64_t makeKey(int u, int v) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(u)) << 32) | static_cast<uint32_t>(v);
+    }
+
+    // Fibonacci乘法哈希，取高位作为槽号
+    std::size_t slotOf(uint64_t key) const {
+        return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> shift);
+    }
+
+    // 稠密三角区中名次a < b的顶点对的边下标（按行排列）
+    int triangleSlot(int a, int b) const {
+        return static_cast<int>(static_cast<long long>(a) * (2LL * triangleVertices - a - 1) / 2 + (b - a - 1));
+    }
+
+    // 扩容到至少能容纳minCapacity个槽（2的幂），并重新插入已有键
+    void rehash(std::size_t minCapacity);
+
+public:
+    EdgeIndex();
+
+    /**
+     * @brief 查找边(u, v)的下标
+     * @return 边在边数组中的下标，不存在时返回-1
+     * @note 调用方保证u < v
+     */
+    int find(int u, int v) const {
+        if (v < static_cast<int>(triangleRank.size())) {
+            int a = triangleRank[u];
+            int b = triangleRank[v];
+            if (a >= 0 && b > a) { // u == v时a == b，不是边
+                return triangleSlot(a, b);
+            }
+        }
+        if (count == 0) return -1;
+        uint64_t key = makeKey(u, v);
+        std::size_t mask = keys.size() - 1;
+        for (std::size_t slot = slotOf(key);; slot = (slot + 1) & mask) {
+            if (keys[slot] == key) return values[slot];
+            if (keys[slot] == EMPTY_KEY) return -1;
+        }
+    }
+
+    /**
+     * @brief 插入边(u, v) -> index，键已存在时覆盖下标
+     * @note 调用方保证u < v且边不在稠密三角区中（三角区内的边已有下标）；装载因子超过1/2时自动扩容
+     */
+    void insert(int u, int v, int index);
+
+    /**
+     * @brief 登记稠密三角区：m个顶点两两之间的边依次占据下标[0, m(m-1)/2)
+     * @param vertexIds 三角区的顶点，严格升序
+     * @param m 顶点数
+     * @param vertexCount 图的顶点总数
+     * @note 名次a < b的顶点对位于第a行，下标为a(2m-a-1)/2 + (b-a-1)；调用时索引须为空
+     */
+    void setTriangle(const int* vertexIds, int m, int vertexCount);
+
+    // 预留至少能存放n条边的空间，避免插入过程中反复扩容
+    void reserve(int n);
+
+    // 清空索引（保留已分配的槽）
+    void clear();
+
+    int size() const {
+        return count + static_cast<int>(static_cast<long long>(triangleVertices) * (triangleVertices - 1) / 2);
+    }
+};
+
+#endif // EDGE_INDEX_H
@@ -1,18 +1,31 @@
 /**
  * @file Graph.cpp
  * @brief 图数据结构实现文件，包含图的创建、操作和Kruskal算法
- * @class Graph
- * @brief 图类，使用边数组存储图结构
+ * @class BasicGraph
+ * @brief 图类模板，使用边数组存储图结构；对int、long long、float、double边权显式实例化
  *
  */
 
 #include "Graph.h"
 #include "UnionFind.h"
+#include "ConcurrentUnionFind.h"
 #include "Node.h"
+#include "Delaunay.h"
+#include "KdTree.h"
+#include "ManhattanMST.h"
+#include "SpatialGrid.h"
+#include "DistanceKernel.h"
+#include "ThreadPool.h"
+#include "ParallelSort.h"
+#include "Logger.h"
 #include <iostream>
 #include <algorithm>
+#include <atomic>
 #include <climits>
+#include <cstdint>
+#include <limits>
 #include <cmath>
+#include <utility>
 
 
  /**
@@ -20,55 +33,52 @@
   * @param v 图中顶点数量，必须为正整数
   * @exception std::invalid_argument 当v<=0时抛出异常
   */
-Graph::Graph(int v) : vertices(v), edgeCount(0), maxEdges(v* (v - 1) / 2), mstEdgeCount(0) {
+template <typename W>
+BasicGraph<W>::BasicGraph(int v) : vertices(v), maxEdges(0), mstEdgeCount(0),
+    mstTotalWeight(0), roundDistances(false),
+    candidateNeighbors(DEFAULT_CANDIDATE_NEIGHBORS), version(1), mstVersion(0), mstImplicit(false), workerThreads(0) {
     // 输入验证
     if (v <= 0) {
         std::cerr << "错误：顶点数必须为正整数" << std::endl;
         vertices = 1;
-        maxEdges = 0;
     }
 
-    // 分配边数组内存
-    edgesArray = new Edge * [maxEdges];
-    for (int i = 0; i < maxEdges; ++i) {
-        edgesArray[i] = nullptr;
-    }
+    // 完全图边数 v*(v-1)/2，按64位计算避免溢出
+    long long completeEdges = static_cast<long long>(vertices) * (vertices - 1) / 2;
+    maxEdges = static_cast<int>(std::min<long long>(completeEdges, INT_MAX));
+
+    // 边数组为连续存储，按需增长，
+    // 避免大规模点集（仅使用稀疏候选边时）预先分配O(V^2)的空间
 
     // 分配MST边数组内存
-    mstEdgesArray = new Edge * [vertices - 1]; // MST最多有vertices-1条边
-    for (int i = 0; i < vertices - 1; ++i) {
-        mstEdgesArray[i] = nullptr;
-    }
+    mstEdgesArray.resize(vertices - 1); // MST最多有vertices-1条边
 
-    // 初始化节点坐标向量
-    xCoords.resize(vertices, 0.0);
-    yCoords.resize(vertices, 0.0);
+    // 初始化节点坐标（均位于原点）
+    nodes.resize(vertices);
 
-    std::cout << "图初始化完成：顶点数=" << vertices
-        << ", 最大边数=" << maxEdges << std::endl;
+    LOG_TRACE("图初始化完成：顶点数=" << vertices
+        << ", 最大边数=" << maxEdges);
 }
 
 /**
- * @brief 图类析构函数
- * @note 释放边数组占用的所有内存资源，防止内存泄漏
+ * @brief 由节点集构造图
+ * @param nodeSet 节点坐标，移动接管，不做拷贝；顶点数为nodeSet.size()
+ * @note 之后调用NodesToEdges(graph, mode)即可按这些坐标建边
  */
-Graph::~Graph() {
-    // 释放边数组
-    if (edgesArray != nullptr) {
-        for (int i = 0; i < maxEdges; ++i) {
-            delete edgesArray[i];
-        }
-        delete[] edgesArray;
+template <typename W>
+BasicGraph<W>::BasicGraph(NodeSet&& nodeSet) : BasicGraph(nodeSet.size()) {
+    if (nodeSet.size() == vertices) {
+        nodes = std::move(nodeSet);
     }
-    
-    // 释放MST边数组
-    if (mstEdgesArray != nullptr) {
-        for (int i = 0; i < vertices - 1; ++i) {
-            delete mstEdgesArray[i];
-        }
-        delete[] mstEdgesArray;
-    }
-    std::cout << "图资源已释放" << std::endl;
+}
+
+/**
+ * @brief 图类析构函数
+ * @note 边数组与MST边数组均为连续存储，由std::vector自动释放
+ */
+template <typename W>
+BasicGraph<W>::~BasicGraph() {
+    LOG_TRACE("图资源已释放");
 }
 
 
@@ -78,9 +88,11 @@ Graph::~Graph() {
  * @param v 边的目标顶点索引，范围[0, vertices-1]
  * @param weight 边的权重值
  * @exception std::out_of_range 当顶点索引越界时输出错误信息
- * @note 对于无向图，确保u < v以避免重复存储，提高Kruskal算法效率
+ * @note 对于无向图，确保u < v以避免重复存储，提高Kruskal算法效率；
+ *       通过edgeIndex哈希查重，插入与更新均摊O(1)
  */
-void Graph::addEdge(int u, int v, int weight) {
+template <typename W>
+void BasicGraph<W>::addEdge(int u, int v, W weight) {
     // 边界检查
     if (u < 0 || u >= vertices || v < 0 || v >= vertices) {
         std::cerr << "错误：顶点索引越界 (" << u << ", " << v << ")" << std::endl;
@@ -98,28 +110,164 @@ void Graph::addEdge(int u, int v, int weight) {
     }
 
     // 检查边是否已存在,已经存在则更新边的权重
-    for (int i = 0; i < edgeCount; ++i) {
-        if (edgesArray[i] != nullptr &&
-            edgesArray[i]->getSrc() == u && edgesArray[i]->getDest() == v) {
-            // 边已存在，更新权重
-            std::cout << "更新边权重: " << u << " - " << v
-                << " 旧权重: " << edgesArray[i]->getWeight()
-                << " -> 新权重: " << weight << std::endl;
-            edgesArray[i]->setWeight(weight);
-            return;
-        }
+    int existing = edgeIndex.find(u, v);
+    if (existing >= 0) {
+        EdgeType& edge = edgesArray[existing];
+        // 边已存在，更新权重
+        LOG_TRACE("更新边权重: " << u << " - " << v
+            << " 旧权重: " << edge.getWeight()
+            << " -> 新权重: " << weight);
+        edge.setWeight(weight);
+        version++;
+        return;
+    }
+
+    addUniqueEdge(u, v, weight);
+}
+
+/**
+ * @brief 向图中添加一条已知不重复的无向边
+ * @param u 边的起始顶点索引，范围[0, vertices-1]
+ * @param v 边的目标顶点索引，范围[0, vertices-1]
+ * @param weight 边的权重值
+ * @note 跳过addEdge中的查重，供批量生成无重复候选边（如Delaunay边）时使用；仍会登记到edgeIndex
+ */
+template <typename W>
+void BasicGraph<W>::addUniqueEdge(int u, int v, W weight) {
+    // 边界检查
+    if (u < 0 || u >= vertices || v < 0 || v >= vertices) {
+        std::cerr << "错误：顶点索引越界 (" << u << ", " << v << ")" << std::endl;
+        return;
+    }
+
+    if (u == v) {
+        std::cerr << "警告：忽略自环边 (" << u << "->" << v << ")" << std::endl;
+        return;
+    }
+
+    if (u > v) {
+        std::swap(u, v);
     }
 
     // 检查边数是否超出限制
-    if (edgeCount >= maxEdges) {
+    if (getEdgeCount() >= maxEdges) {
         std::cerr << "错误：边数已达上限 " << maxEdges << "，无法添加新边" << std::endl;
         return;
     }
 
-    // 添加新边
-    edgesArray[edgeCount] = new Edge(u, v, weight);
-    edgeCount++;
-   
+    // 添加新边（连续存储，无逐边堆分配）并登记索引
+    edgeIndex.insert(u, v, getEdgeCount());
+    edgesArray.emplace_back(u, v, weight);
+    version++;
+}
+
+/**
+ * @brief 预留边数组容量
+ * @param n 预计的边数（超过maxEdges时按maxEdges截断）
+ */
+template <typename W>
+void BasicGraph<W>::reserveEdges(int n) {
+    n = std::min(n, maxEdges);
+    edgesArray.reserve(n);
+    edgeIndex.reserve(n);
+}
+
+/**
+ * @brief 批量添加给定顶点两两之间的全部边
+ * @param vertexIds 顶点下标，严格升序
+ * @param xs 各顶点的X坐标（与vertexIds一一对应）
+ * @param ys 各顶点的Y坐标
+ * @param n 顶点数
+ * @return 成功返回true；图中已有边、坐标含NaN/无穷或两点距离可能溢出时返回false，图不变，
+ *         调用方应改为逐边添加
+ * @note 边数组一次性扩到n(n-1)/2，第i行（vertexIds[i]与其后各顶点的边）占据连续下标，
+ *       按边数把三角形均分为若干块，由线程池各线程无锁写入各自的下标区间；
+ *       每块内按行分段调用DistanceKernel求距离。边的顺序与逐对addEdge相同，
+ *       边索引登记为稠密三角区，不逐边插入哈希表
+ */
+template <typename W>
+bool BasicGraph<W>::addCompleteEdges(const int* vertexIds, const double* xs, const double* ys, int n) {
+    if (getEdgeCount() > 0 || n < 2) {
+        return false;
+    }
+    for (int i = 0; i < n; i++) {
+        if (vertexIds[i] < 0 || vertexIds[i] >= vertices || (i > 0 && vertexIds[i] <= vertexIds[i - 1])) {
+            std::cerr << "错误：批量建边的顶点下标无效或未升序 (" << vertexIds[i] << ")" << std::endl;
+            return false;
+        }
+    }
+
+    long long totalEdges = static_cast<long long>(n) * (n - 1) / 2;
+    if (totalEdges > maxEdges) {
+        std::cerr << "错误：边数 " << totalEdges << " 超出上限 " << maxEdges << "，无法批量建边" << std::endl;
+        return false;
+    }
+
+    // 坐标均有限且范围的对角线有限时，任意两点间的距离都有限，块内无需逐边检查
+    double minX = xs[0], maxX = xs[0], minY = ys[0], maxY = ys[0];
+    for (int i = 0; i < n; i++) {
+        if (!std::isfinite(xs[i]) || !std::isfinite(ys[i])) {
+            return false;
+        }
+        minX = std::min(minX, xs[i]);
+        maxX = std::max(maxX, xs[i]);
+        minY = std::min(minY, ys[i]);
+        maxY = std::max(maxY, ys[i]);
+    }
+    double spanX = maxX - minX;
+    double spanY = maxY - minY;
+    if (!std::isfinite(spanX * spanX + spanY * spanY)) {
+        return false;
+    }
+
+    const int edgeCount = static_cast<int>(totalEdges);
+    edgesArray.resize(edgeCount);
+    EdgeType* out = edgesArray.data();
+
+    // 第i行的起始下标
+    auto rowStart = [n](long long i) { return i * (2LL * n - i - 1) / 2; };
+
+    // 生成下标区间[first, last)内的边：先二分定位起始行，再逐行分段求距离
+    const int SEGMENT = 512; // 每段的距离缓冲在L1缓存内
+    auto buildRange = [&](long long first, long long last) {
+        double distances[SEGMENT];
+        int lo = 0, hi = n - 2;
+        while (lo < hi) {
+            int mid = lo + (hi - lo + 1) / 2;
+            if (rowStart(mid) <= first) lo = mid;
+            else hi = mid - 1;
+        }
+        long long slot = first;
+        for (int i = lo; slot < last; i++) {
+            int j = i + 1 + static_cast<int>(slot - rowStart(i));
+            int rowEnd = static_cast<int>(std::min<long long>(n, j + (last - slot)));
+            for (; j < rowEnd; j += SEGMENT) {
+                int length = std::min(SEGMENT, rowEnd - j);
+                DistanceKernel::distanceRow(xs[i], ys[i], xs + j, ys + j, length, distances);
+                for (int k = 0; k < length; k++) {
+                    out[slot++] = EdgeType(vertexIds[i], vertexIds[j + k], distanceToWeight(distances[k]));
+                }
+            }
+        }
+    };
+
+    ThreadPool* pool = edgeCount >= PARALLEL_BUILD_THRESHOLD ? workerPool() : nullptr;
+    if (pool == nullptr) {
+        buildRange(0, edgeCount);
+    }
+    else {
+        // 每线程约8块，动态领取以平衡负载
+        int tiles = pool->getThreadCount() * 8;
+        pool->parallelFor(0, tiles, 1, [&](int firstTile, int lastTile) {
+            for (int t = firstTile; t < lastTile; t++) {
+                buildRange(totalEdges * t / tiles, totalEdges * (t + 1) / tiles);
+            }
+        });
+    }
+
+    edgeIndex.setTriangle(vertexIds, n, vertices);
+    version++;
+    return true;
 }
 
 /**
@@ -128,20 +276,29 @@ void Graph::addEdge(int u, int v, int weight) {
  * @param v 目标顶点索引
  * @return true如果存在边u-v，false否则
  */
-bool Graph::hasEdge(int u, int v) const {
+template <typename W>
+bool BasicGraph<W>::hasEdge(int u, int v) const {
     // 统一处理为u < v的形式
     if (u > v) {
         std::swap(u, v);
     }
     
-    for (int i = 0; i < edgeCount; ++i) {
-        if (edgesArray[i] != nullptr &&
-            edgesArray[i]->getSrc() == u && edgesArray[i]->getDest() == v) {
-            return true;
-        }
+    return edgeIndex.find(u, v) >= 0;
+}
+
+/**
+ * @brief 查找边u-v在边数组中的下标
+ * @param u 一个端点
+ * @param v 另一个端点
+ * @return 边在getEdges()中的下标，不存在时为-1
+ */
+template <typename W>
+int BasicGraph<W>::findEdge(int u, int v) const {
+    if (u > v) {
+        std::swap(u, v);
     }
-    
-    return false;
+
+    return edgeIndex.find(u, v);
 }
 
 
@@ -160,91 +317,313 @@ double calDistance(double x1, double x2, double y1, double y2) {
 }
 
 /**
- * @brief 将节点数组转换为图的边
- * @param graph 图对象的引用，用于添加边
- * @param nodes 节点指针数组
- * @param nodes_n 节点数量
- * @note 为每对不同的节点计算欧几里得距离作为边权重，并添加到图中
+ * @brief 追加一个顶点，连向所有已有顶点，并增量更新最小生成树
+ * @param x 新顶点的X坐标
+ * @param y 新顶点的Y坐标
+ * @return 新顶点的下标（即追加前的顶点数）；坐标非有限值时不追加并返回-1
+ * @note 新边按欧氏距离经distanceToWeight转换，与NodesToEdges的Complete方式一致。
+ *       加点后的MST必然包含于"原MST边 + 新顶点的边"：不在原MST中的边是某个环上的最重边，
+ *       加点后该环仍在。因此只需对至多2V-3条边运行Kruskal，O(V log V)，无需重排全部边。
+ *       MST与当前边集不一致（isMSTCurrent()为false）或来自primMSTImplicit时只追加顶点和边，由调用方重新求解
  */
-void NodesToEdges(Graph& graph, Node* nodes[], int nodes_n) {
-    // 输入参数验证
-    if (nodes == nullptr) {
-        std::cerr << "错误：节点数组指针为 nullptr" << std::endl;
-        return;
+template <typename W>
+int BasicGraph<W>::addVertex(double x, double y) {
+    // 非有限坐标得到的距离无法转换为权重
+    if (!std::isfinite(x) || !std::isfinite(y)) {
+        std::cerr << "错误：新顶点的坐标值无效 (" << x << ", " << y << ")" << std::endl;
+        return -1;
     }
 
-    if (nodes_n <= 1) {
-        std::cerr << "警告：节点数量 " << nodes_n << " 不足，无法形成边" << std::endl;
-        return;
+    bool incremental = isMSTCurrent() && !mstImplicit;
+    int v = vertices++;
+    version++;
+
+    long long completeEdges = static_cast<long long>(vertices) * (vertices - 1) / 2;
+    maxEdges = static_cast<int>(std::min<long long>(completeEdges, INT_MAX));
+    nodes.add(x, y);
+    mstEdgesArray.resize(vertices - 1);
+
+    int firstNewEdge = getEdgeCount();
+    std::vector<double> distances(v);
+    DistanceKernel::distanceRow(x, y, nodes.xData(), nodes.yData(), v, distances.data());
+    for (int u = 0; u < v; u++) {
+        addUniqueEdge(u, v, distanceToWeight(distances[u]));
     }
 
-    std::cout << "开始将 " << nodes_n << " 个节点转换为边..." << std::endl;
-    int edgesAdded = 0;
+    if (!incremental) {
+        LOG_TRACE("追加顶点 " << v << "，MST需重新求解");
+        return v;
+    }
+
+    // 原MST边与新顶点的边合并后运行Kruskal
+    std::vector<EdgeType>& candidates = workspace.sortedEdges;
+    candidates.assign(mstEdgesArray.begin(), mstEdgesArray.begin() + mstEdgeCount);
+    candidates.insert(candidates.end(), edgesArray.begin() + firstNewEdge, edgesArray.end());
+    std::sort(candidates.begin(), candidates.end(), edgeLess);
+
+    clearMST();
+    UnionFind& uf = workspaceUnionFind();
+    WeightSum totalWeight = 0;
+    for (const EdgeType& edge : candidates) {
+        if (mstEdgeCount >= vertices - 1) break;
+        int a = edge.getSrc();
+        int b = edge.getDest();
+        if (uf.find(a) != uf.find(b)) {
+            uf.unite(a, b);
+            mstEdgesArray[mstEdgeCount++] = edge;
+            totalWeight += edge.getWeight();
+        }
+    }
+    mstTotalWeight = totalWeight;
+    mstVersion = version;
+
+    LOG_TRACE("追加顶点 " << v << "，增量更新MST：候选边 " << candidates.size()
+        << "，MST边数 " << mstEdgeCount << "，总权重 " << totalWeight);
+    return v;
+}
+
+// 候选边生成方式的名称，用于日志
+static const char* candidateModeName(EdgeBuildMode mode) {
+    switch (mode) {
+    case EdgeBuildMode::KNearest: return "k近邻";
+    case EdgeBuildMode::Manhattan: return "曼哈顿扇区";
+    case EdgeBuildMode::SpatialGrid: return "空间网格";
+    default: return "Delaunay剖分";
+    }
+}
+
+/**
+ * @brief 校验节点坐标，把有效节点的坐标收集为连续的SoA数组
+ * @param nodes 节点指针数组
+ * @param nodes_n 节点数量
+ * @param xs 输出：有效节点的X坐标
+ * @param ys 输出：有效节点的Y坐标
+ * @param validIndex 输出：有效节点在nodes中的下标
+ * @return 跳过的节点数（空指针或坐标为NaN/无穷）
+ */
+static int collectValidNodes(Node* nodes[], int nodes_n, std::vector<double>& xs,
+                             std::vector<double>& ys, std::vector<int>& validIndex) {
+    xs.clear();
+    ys.clear();
+    validIndex.clear();
+    xs.reserve(nodes_n);
+    ys.reserve(nodes_n);
+    validIndex.reserve(nodes_n);
     int skippedCount = 0;
 
-    // 遍历所有节点对
     for (int i = 0; i < nodes_n; i++) {
-        // 检查当前节点是否有效
         if (nodes[i] == nullptr) {
             std::cerr << "警告：跳过空节点索引 " << i << std::endl;
             skippedCount++;
             continue;
         }
 
-        for (int j = i + 1; j < nodes_n; j++) {
-            // 检查目标节点是否有效
-            if (nodes[j] == nullptr) {
-                std::cerr << "警告：跳过空节点索引 " << j << std::endl;
-                skippedCount++;
-                continue;
-            }
+        double x = nodes[i]->getX();
+        double y = nodes[i]->getY();
+        if (std::isnan(x) || std::isnan(y) || std::isinf(x) || std::isinf(y)) {
+            std::cerr << "警告：节点 " << i << " 的坐标值无效，跳过" << std::endl;
+            skippedCount++;
+            continue;
+        }
 
-            try {
-                // 计算节点间的欧几里得距离
-                double x1 = nodes[i]->getX();
-                double y1 = nodes[i]->getY();
-                double x2 = nodes[j]->getX();
-                double y2 = nodes[j]->getY();
-
-                // 验证坐标值有效性
-                if (std::isnan(x1) || std::isnan(y1) || std::isnan(x2) || std::isnan(y2) ||
-                    std::isinf(x1) || std::isinf(y1) || std::isinf(x2) || std::isinf(y2)) {
-                    std::cerr << "警告：节点 " << i << " 或 " << j << " 的坐标值无效，跳过边创建" << std::endl;
-                    skippedCount++;
-                    continue;
-                }
+        xs.push_back(x);
+        ys.push_back(y);
+        validIndex.push_back(i);
+    }
+    return skippedCount;
+}
+
+/**
+ * @brief 以候选边（Delaunay三角剖分边、k近邻边、曼哈顿扇区边或网格近邻边）代替完全图生成边
+ * @param graph 图对象的引用，用于添加边
+ * @param xs 有效节点的X坐标（连续存储）
+ * @param ys 有效节点的Y坐标
+ * @param vertexIds 各有效节点对应的顶点下标
+ * @param count 有效节点数
+ * @param skippedCount 已跳过的无效节点数（用于日志）
+ * @param mode Delaunay、KNearest（k取graph.getCandidateNeighbors()）、Manhattan或SpatialGrid
+ * @note 边数O(V)或O(kV)，耗时O(V log V)；候选边集包含对应度量下的最小生成树，
+ *       权重按distanceToWeight转换，Kruskal得到的MST总权重与该度量下的完全图相同（Manhattan模式权重为L1距离）
+ */
+template <typename W>
+static void CandidateEdgesFromCoordinates(BasicGraph<W>& graph, const double* xs, const double* ys,
+                                          const int* vertexIds, int count, int skippedCount, EdgeBuildMode mode) {
+    std::vector<std::pair<int, int>> candidates;
+    if (mode == EdgeBuildMode::KNearest) {
+        KdTree::candidateEdges(xs, ys, count, graph.getCandidateNeighbors(), candidates);
+    }
+    else if (mode == EdgeBuildMode::Manhattan) {
+        ManhattanMST::candidateEdges(xs, ys, count, candidates);
+    }
+    else if (mode == EdgeBuildMode::SpatialGrid) {
+        SpatialGrid::candidateEdges(xs, ys, count, candidates);
+    }
+    else {
+        Delaunay::triangulateEdges(xs, ys, count, candidates);
+    }
+
+    graph.reserveEdges(static_cast<int>(candidates.size()));
+    for (const auto& e : candidates) {
+        double dis = mode == EdgeBuildMode::Manhattan
+            ? ManhattanMST::distance(xs[e.first], ys[e.first], xs[e.second], ys[e.second])
+            : calDistance(xs[e.first], xs[e.second], ys[e.first], ys[e.second]);
+        // 候选边互不重复，直接追加
+        graph.addUniqueEdge(vertexIds[e.first], vertexIds[e.second], graph.distanceToWeight(dis));
+    }
 
-                float dis = calDistance(x1, x2, y1, y2);
+    LOG_SUMMARY(candidateModeName(mode) << "候选边生成完成：成功添加 " << candidates.size() << " 条候选边，跳过 "
+        << skippedCount << " 个无效节点");
+}
 
-                // 验证距离值有效性
-                if (dis < 0 || std::isnan(dis) || std::isinf(dis)) {
-                    std::cerr << "警告：节点 " << i << " 和 " << j << " 的计算距离无效: " << dis << "，跳过边创建" << std::endl;
+/**
+ * @brief 为给定节点两两连边（完全图）
+ * @param graph 图对象的引用，用于添加边
+ * @param xs 有效节点的X坐标（连续存储，均为有限值）
+ * @param ys 有效节点的Y坐标
+ * @param vertexIds 各有效节点对应的顶点下标，严格升序
+ * @param count 有效节点数
+ * @param skippedCount 已跳过的无效节点数（用于日志）
+ */
+template <typename W>
+static void CompleteEdgesFromCoordinates(BasicGraph<W>& graph, const double* xs, const double* ys,
+                                         const int* vertexIds, int count, int skippedCount) {
+    LOG_SUMMARY("开始将 " << count << " 个节点转换为边...");
+    int edgesAdded = 0;
+
+    // 空图上多线程分块批量建边
+    if (graph.addCompleteEdges(vertexIds, xs, ys, count)) {
+        edgesAdded = graph.getEdgeCount();
+    }
+    else if (count > 1) {
+        // 图中已有边或距离可能溢出：逐边添加，已有的边更新权重
+        graph.reserveEdges(static_cast<int>(std::min<long long>(
+            graph.getEdgeCount() + static_cast<long long>(count) * (count - 1) / 2, INT_MAX)));
+        std::vector<double> row(count);
+        for (int i = 0; i + 1 < count; i++) {
+            int rowLength = count - i - 1;
+            DistanceKernel::distanceRow(xs[i], ys[i], xs + i + 1, ys + i + 1, rowLength, row.data());
+            for (int k = 0; k < rowLength; k++) {
+                int j = i + 1 + k;
+                if (!std::isfinite(row[k])) {
+                    std::cerr << "警告：节点 " << vertexIds[i] << " 和 " << vertexIds[j] << " 的计算距离无效: "
+                              << row[k] << "，跳过边创建" << std::endl;
                     skippedCount++;
                     continue;
                 }
-
-                // 通过 graph 对象调用 addEdge 方法
-                graph.addEdge(i, j, dis);
+                graph.addEdge(vertexIds[i], vertexIds[j], graph.distanceToWeight(row[k]));
                 edgesAdded++;
-
-            }
-            catch (const std::exception& e) {
-                std::cerr << "错误：处理节点 " << i << " 和 " << j << " 时发生异常: " << e.what() << std::endl;
-                skippedCount++;
-            }
-            catch (...) {
-                std::cerr << "错误：处理节点 " << i << " 和 " << j << " 时发生未知异常" << std::endl;
-                skippedCount++;
             }
         }
     }
 
-    std::cout << "节点转换完成：成功添加 " << edgesAdded << " 条边，跳过 " << skippedCount << " 个无效节点/边" << std::endl;
+    LOG_SUMMARY("节点转换完成：成功添加 " << edgesAdded << " 条边，跳过 " << skippedCount << " 个无效节点/边");
+}
+
+/**
+ * @brief 按建边方式为已校验的节点坐标生成边
+ */
+template <typename W>
+static void EdgesFromCoordinates(BasicGraph<W>& graph, const double* xs, const double* ys,
+                                 const int* vertexIds, int count, int skippedCount, EdgeBuildMode mode) {
+    if (mode == EdgeBuildMode::Complete) {
+        CompleteEdgesFromCoordinates(graph, xs, ys, vertexIds, count, skippedCount);
+    }
+    else {
+        CandidateEdgesFromCoordinates(graph, xs, ys, vertexIds, count, skippedCount, mode);
+    }
+}
+
+/**
+ * @brief 将节点数组转换为图的边
+ * @param graph 图对象的引用，用于添加边
+ * @param nodes 节点指针数组
+ * @param nodes_n 节点数量
+ * @param mode 边生成方式，默认完全图；Delaunay模式仅生成三角剖分边，KNearest模式仅生成k近邻候选边，
+ *             Manhattan模式按L1距离仅生成扇区候选边，SpatialGrid模式仅生成网格近邻候选边
+ * @note 为每对不同的节点计算欧几里得距离作为边权重，并添加到图中；节点坐标同时保存到图中。
+ *       坐标已在NodeSet中时应使用NodesToEdges(graph, mode)，无需逐节点对象
+ */
+template <typename W>
+void NodesToEdges(BasicGraph<W>& graph, Node* nodes[], int nodes_n, EdgeBuildMode mode) {
+    // 输入参数验证
+    if (nodes == nullptr) {
+        std::cerr << "错误：节点数组指针为 nullptr" << std::endl;
+        return;
+    }
+
+    if (nodes_n <= 1) {
+        std::cerr << "警告：节点数量 " << nodes_n << " 不足，无法形成边" << std::endl;
+        return;
+    }
+
+    // 保存节点坐标到Graph对象
+    for (int i = 0; i < nodes_n; i++) {
+        if (nodes[i] != nullptr) {
+            graph.setNodeCoordinates(i, nodes[i]->getX(), nodes[i]->getY());
+        }
+    }
+
+    // 坐标在建边前统一校验，内层循环只做距离计算与加边
+    std::vector<double> xs;
+    std::vector<double> ys;
+    std::vector<int> validIndex;
+    int skippedCount = collectValidNodes(nodes, nodes_n, xs, ys, validIndex);
+    EdgesFromCoordinates(graph, xs.data(), ys.data(), validIndex.data(),
+                         static_cast<int>(xs.size()), skippedCount, mode);
+}
+
+/**
+ * @brief 按图中保存的节点坐标（NodeSet）生成边
+ * @param graph 图对象的引用，其坐标通常由BasicGraph(NodeSet&&)移动接管
+ * @param mode 边生成方式，含义同上
+ * @note 坐标全部有效时直接把NodeSet的连续数组交给建边函数，不做任何拷贝；
+ *       含NaN/无穷坐标时只对有效节点建边
+ */
+template <typename W>
+void NodesToEdges(BasicGraph<W>& graph, EdgeBuildMode mode) {
+    const NodeSet& nodes = graph.getNodes();
+    const int n = nodes.size();
+    if (n <= 1) {
+        std::cerr << "警告：节点数量 " << n << " 不足，无法形成边" << std::endl;
+        return;
+    }
+
+    std::vector<int> vertexIds;
+    vertexIds.reserve(n);
+    if (nodes.allFinite()) {
+        for (int i = 0; i < n; i++) {
+            vertexIds.push_back(i);
+        }
+        EdgesFromCoordinates(graph, nodes.xData(), nodes.yData(), vertexIds.data(), n, 0, mode);
+        return;
+    }
+
+    // 含无效坐标：收集有效节点
+    std::vector<double> xs;
+    std::vector<double> ys;
+    int skippedCount = 0;
+    for (int i = 0; i < n; i++) {
+        double x = nodes.getX(i);
+        double y = nodes.getY(i);
+        if (!std::isfinite(x) || !std::isfinite(y)) {
+            std::cerr << "警告：节点 " << i << " 的坐标值无效，跳过" << std::endl;
+            skippedCount++;
+            continue;
+        }
+        xs.push_back(x);
+        ys.push_back(y);
+        vertexIds.push_back(i);
+    }
+    EdgesFromCoordinates(graph, xs.data(), ys.data(), vertexIds.data(),
+                         static_cast<int>(xs.size()), skippedCount, mode);
 }
+
 /**
  * @brief 打印图的边列表信息
  */
-void Graph::printGraph() const {
+template <typename W>
+void BasicGraph<W>::printGraph() const {
+    const int edgeCount = getEdgeCount();
     std::cout << "\n图信息概览:" << std::endl;
     std::cout << "顶点数: " << vertices << std::endl;
     std::cout << "边数: " << edgeCount << std::endl;
@@ -259,41 +638,38 @@ void Graph::printGraph() const {
     std::cout << "----------------------------" << std::endl;
 
     for (int i = 0; i < edgeCount; ++i) {
-        if (edgesArray[i] != nullptr) {
-            std::cout << i << "\t" << edgesArray[i]->getSrc() << "\t"
-                << edgesArray[i]->getDest() << "\t"
-                << edgesArray[i]->getWeight() << std::endl;
-        }
+        std::cout << i << "\t" << edgesArray[i].getSrc() << "\t"
+            << edgesArray[i].getDest() << "\t"
+            << edgesArray[i].getWeight() << std::endl;
     }
     std::cout << std::endl;
 }
 /**
  * @brief 堆排序的堆化操作
- * @param edges 边指针数组
+ * @param edges 边数组
  * @param n 当前堆的大小
  * @param i 需要堆化的子树根节点索引
  * @note 维护最大堆性质，时间复杂度O(log n)
  */
-void Graph::heapify(Edge* edges[], int n, int i) const {
+template <typename W>
+void BasicGraph<W>::heapify(EdgeType edges[], int n, int i) const {
     int largest = i;
     int left = 2 * i + 1;
     int right = 2 * i + 2;
 
-    // 找到左子节点、右子节点和当前节点中的最大值
-    if (left < n && edges[left]->getWeight() > edges[largest]->getWeight()) {
+    // 找到左子节点、右子节点和当前节点中的最大值（按edgeLess全序，保证结果确定）
+    if (left < n && edgeLess(edges[largest], edges[left])) {
         largest = left;
     }
 
-    if (right < n && edges[right]->getWeight() > edges[largest]->getWeight()) {
+    if (right < n && edgeLess(edges[largest], edges[right])) {
         largest = right;
     }
 
     // 如果最大值不是当前节点，交换并递归调整
     if (largest != i) {
-        // 直接交换指针
-        Edge* temp = edges[i];
-        edges[i] = edges[largest];
-        edges[largest] = temp;
+        // 交换连续存储的边
+        std::swap(edges[i], edges[largest]);
 
         // 递归调整受影响子树
         heapify(edges, n, largest);
@@ -301,11 +677,12 @@ void Graph::heapify(Edge* edges[], int n, int i) const {
 }
 /**
  * @brief 构建最大堆
- * @param edges 边指针数组
+ * @param edges 边数组
  * @param n 数组大小
  * @note 从最后一个非叶子节点开始构建堆，时间复杂度O(n)，原地操作
  */
-void Graph::buildHeap(Edge* edges[], int n) const {
+template <typename W>
+void BasicGraph<W>::buildHeap(EdgeType edges[], int n) const {
     // 从最后一个非叶子节点开始构建堆
     for (int i = n / 2 - 1; i >= 0; i--) {
         heapify(edges, n, i);
@@ -313,11 +690,29 @@ void Graph::buildHeap(Edge* edges[], int n) const {
 }
 /**
  * @brief 对边数组进行堆排序
- * @param edges 边指针数组
+ * @param edges 边数组
  * @param n 数组大小
- * @note 使用堆排序算法对边按权重升序排列，时间复杂度O(n log n)，完全原地操作
+ * @note 使用堆排序算法对边按edgeLess升序排列（权重相同按端点），时间复杂度O(n log n)；
+ *       n达到PARALLEL_SORT_THRESHOLD且并行度大于1时，各线程分块堆排序后并行归并。
+ *       edgeLess是全序，并行与串行结果完全相同
  */
-void Graph::heapSortEdges(Edge* edges[], int n) const {
+template <typename W>
+void BasicGraph<W>::heapSortEdges(EdgeType edges[], int n) {
+    ThreadPool* pool = n >= PARALLEL_SORT_THRESHOLD ? workerPool() : nullptr;
+    if (pool == nullptr) {
+        heapSortRange(edges, n);
+        return;
+    }
+
+    workspace.mergeEdges.resize(n);
+    ParallelSort::mergeSort(*pool, edges, workspace.mergeEdges.data(), n, edgeLess,
+        [this](int, EdgeType* first, int count) { heapSortRange(first, count); },
+        pool->getThreadCount(), workspace.mergeRuns);
+}
+
+// 串行原地堆排序
+template <typename W>
+void BasicGraph<W>::heapSortRange(EdgeType edges[], int n) const {
     if (n <= 1) return;
 
     // 构建最大堆
@@ -332,124 +727,716 @@ void Graph::heapSortEdges(Edge* edges[], int n) const {
     }
 }
 
+/**
+ * @brief 对边下标做LSD基数排序
+ * @param order 输出：边下标的排列，使edgesArray[order[i]]按edgeLess升序
+ * @note 依次以dest、src、weight为键做稳定的11位分组计数排序（低位键先排），
+ *       得到与edgeLess完全一致的顺序。边权经WeightTraits<W>::toKey映射为同序的无符号键，
+ *       整数与浮点边权使用同一套排序。每个键先减去最小值，只处理实际用到的位数，
+ *       所有元素落在同一桶的趟次直接跳过。时间O(E)，访存为顺序扫描
+ */
+template <typename W>
+void BasicGraph<W>::radixSortEdgeOrder(std::vector<int>& order) {
+    const int edgeCount = getEdgeCount();
+
+    order.resize(edgeCount);
+    for (int i = 0; i < edgeCount; i++) {
+        order[i] = i;
+    }
+
+    ThreadPool* pool = edgeCount >= PARALLEL_SORT_THRESHOLD ? workerPool() : nullptr;
+    if (pool == nullptr) {
+        radixSortEdgeRange(order.data(), edgeCount, workspace.radix);
+        return;
+    }
+
+    // 各线程分块基数排序，再按edgeLess并行归并下标
+    int chunks = pool->getThreadCount();
+    workspace.chunkRadix.resize(chunks);
+    workspace.mergeOrder.resize(edgeCount);
+    ParallelSort::mergeSort(*pool, order.data(), workspace.mergeOrder.data(), edgeCount,
+        [this](int a, int b) { return edgeLess(edgesArray[a], edgesArray[b]); },
+        [this](int chunk, int* first, int count) {
+            radixSortEdgeRange(first, count, workspace.chunkRadix[chunk]);
+        },
+        chunks, workspace.mergeRuns);
+}
+
+/**
+ * @brief 串行基数排序一段边下标
+ * @param order 待排序的边下标，结果写回原处
+ * @param n 下标个数
+ * @param scratch 辅助缓冲区（复用容量）
+ */
+template <typename W>
+void BasicGraph<W>::radixSortEdgeRange(int order[], int n, RadixScratch& scratch) const {
+    const int RADIX_BITS = 11;
+    const int BUCKETS = 1 << RADIX_BITS;
+    if (n <= 1) {
+        return;
+    }
+
+    scratch.tmpOrder.resize(n);
+    scratch.keys.resize(n);
+    scratch.tmpKeys.resize(n);
+    scratch.counts.resize(BUCKETS);
+    int* ord = order;
+    int* tmpOrd = scratch.tmpOrder.data();
+    KeyType* keys = scratch.keys.data();
+    KeyType* tmpKeys = scratch.tmpKeys.data();
+    int* counts = scratch.counts.data();
+    // 收集一个字段的键（减去最小值以减少位数）并做稳定的分组计数排序；
+    // 字段提取在外层分派，内层循环不含分支
+    const int KEY_BITS = static_cast<int>(sizeof(KeyType) * 8);
+    auto sortByField = [&](auto keyOf) {
+        KeyType minKey = keyOf(edgesArray[ord[0]]);
+        KeyType maxKey = minKey;
+        for (int i = 0; i < n; i++) {
+            KeyType k = keyOf(edgesArray[ord[i]]);
+            keys[i] = k;
+            minKey = std::min(minKey, k);
+            maxKey = std::max(maxKey, k);
+        }
+        if (minKey == maxKey) {
+            return; // 该键全部相同，无需排序
+        }
+        for (int i = 0; i < n; i++) {
+            keys[i] -= minKey;
+        }
+
+        KeyType range = maxKey - minKey;
+        for (int shift = 0; shift < KEY_BITS && (range >> shift) != 0; shift += RADIX_BITS) {
+            std::fill(counts, counts + BUCKETS, 0);
+            for (int i = 0; i < n; i++) {
+                counts[(keys[i] >> shift) & (BUCKETS - 1)]++;
+            }
+            if (counts[(keys[0] >> shift) & (BUCKETS - 1)] == n) {
+                continue; // 所有元素落在同一桶
+            }
+
+            // 前缀和得到各桶起始位置
+            int sum = 0;
+            for (int b = 0; b < BUCKETS; b++) {
+                int c = counts[b];
+                counts[b] = sum;
+                sum += c;
+            }
+
+            // 稳定分配
+            for (int i = 0; i < n; i++) {
+                int pos = counts[(keys[i] >> shift) & (BUCKETS - 1)]++;
+                tmpKeys[pos] = keys[i];
+                tmpOrd[pos] = ord[i];
+            }
+            std::swap(keys, tmpKeys);
+            std::swap(ord, tmpOrd);
+        }
+    };
+
+    // 低优先级的键先排：dest、src、weight（顶点下标非负，直接作为键）
+    sortByField([](const EdgeType& e) { return static_cast<KeyType>(e.getDest()); });
+    sortByField([](const EdgeType& e) { return static_cast<KeyType>(e.getSrc()); });
+    sortByField([](const EdgeType& e) { return WeightTraits<W>::toKey(e.getWeight()); });
+
+    // 结果在辅助数组中时拷回
+    if (ord != order) {
+        std::copy(ord, ord + n, order);
+    }
+}
+
 /**
  * @brief 使用Kruskal算法求解最小生成树
- * @note 基于并查集和堆排序实现，专门为边数组存储优化
+ * @note 基于并查集和堆排序实现，专门为边数组存储优化；
+ *       边数达到RADIX_SORT_THRESHOLD时改用基数排序，只排序边下标而不复制边，排序结果与堆排序一致；
+ *       排序缓冲区、并查集均取自workspace，MST边写入预分配的mstEdgesArray，
+ *       同一图上重复求解时首次之后不再分配堆内存
+ *       图的版本号自上次求解后未变时直接沿用已有结果（与filterKruskalMST、boruvkaMST共享，三者结果相同）
  * @exception std::runtime_error 当图不连通时无法生成完整最小生成树
  */
-void Graph::kruskalMST() {
-    std::cout << "\n=== 开始执行Kruskal算法 ===" << std::endl;
+template <typename W>
+void BasicGraph<W>::kruskalMST() {
+    LOG_SUMMARY("\n=== 开始执行Kruskal算法 ===");
+    if (mstVersion == version && !mstImplicit) {
+        LOG_SUMMARY("图未修改，沿用已求得的最小生成树，总权重: " << mstTotalWeight);
+        return;
+    }
+    mstVersion = version; // 以下各分支得到的MST（含空树）均对应当前边集
+    mstImplicit = false;
+
+    const int edgeCount = getEdgeCount();
+
+    // 先清空之前的MST边，空图也不能沿用其他算法留下的旧结果
+    clearMST();
 
     if (edgeCount == 0) {
-        std::cout << "图中没有边，无法生成最小生成树" << std::endl;
+        LOG_SUMMARY("图中没有边，无法生成最小生成树");
         return;
     }
 
     if (vertices <= 1) {
-        std::cout << "顶点数不足，无法生成最小生成树" << std::endl;
+        LOG_SUMMARY("顶点数不足，无法生成最小生成树");
         return;
     }
 
-    // 先清空之前的MST边
-    for (int i = 0; i < mstEdgeCount; ++i) {
-        delete mstEdgesArray[i];
-        mstEdgesArray[i] = nullptr;
+    UnionFind& uf = workspaceUnionFind();
+    WeightSum totalWeight = 0;
+
+    // Kruskal算法核心：按edgeLess顺序遍历边，使用并查集避免环路；edgeAt(i)为第i小的边
+    auto runKruskal = [&](auto edgeAt) {
+        // 逐边明细仅在Trace级别输出，编译期关闭时整个循环被消除
+        if (LOG_IS_ENABLED(LOG_LEVEL_TRACE)) {
+            LOG_TRACE("边按权重排序完成:");
+            for (int i = 0; i < edgeCount; i++) {
+                LOG_TRACE("边 " << i << ": " << edgeAt(i).getSrc() << " - "
+                    << edgeAt(i).getDest() << " 权重: " << edgeAt(i).getWeight());
+            }
+        }
+
+        LOG_TRACE("\n开始构建最小生成树:");
+
+        for (int i = 0; i < edgeCount && mstEdgeCount < vertices - 1; i++) {
+            const EdgeType& currentEdge = edgeAt(i);
+            int u = currentEdge.getSrc();
+            int v = currentEdge.getDest();
+
+            if (uf.find(u) != uf.find(v)) {
+                uf.unite(u, v);
+                mstEdgesArray[mstEdgeCount] = currentEdge;
+                totalWeight += currentEdge.getWeight();
+
+                LOG_TRACE("添加第" << (mstEdgeCount + 1) << "条边: "
+                    << u << " - " << v << " 权重: " << currentEdge.getWeight());
+                mstEdgeCount++;
+            }
+            else {
+                LOG_TRACE("跳过边: " << u << " - " << v
+                    << " 权重: " << currentEdge.getWeight() << " (会形成环路)");
+            }
+        }
+    };
+
+    if (edgeCount >= RADIX_SORT_THRESHOLD) {
+        // 零拷贝：只对4字节的边下标做基数排序，按下标直接读取edgesArray，
+        // 不复制边对象，排序期间的额外内存为下标与键数组
+        const std::vector<int>& order = workspace.order;
+        radixSortEdgeOrder(workspace.order);
+        runKruskal([&](int i) -> const EdgeType& { return edgesArray[order[i]]; });
+    }
+    else {
+        // 边数较少：复制到工作区后堆排序（不打乱edgesArray，重复求解时复用内存）
+        std::vector<EdgeType>& edges = workspace.sortedEdges;
+        edges.assign(edgesArray.begin(), edgesArray.end());
+        heapSortEdges(edges.data(), edgeCount);
+        runKruskal([&](int i) -> const EdgeType& { return edges[i]; });
+    }
+
+    // 输出最终结果
+    LOG_SUMMARY("\n=== Kruskal算法执行完成 ===");
+
+    if (mstEdgeCount == vertices - 1) {
+        LOG_SUMMARY("最小生成树构建成功!");
+        LOG_SUMMARY("最小生成树包含 " << mstEdgeCount << " 条边:");
+        if (LOG_IS_ENABLED(LOG_LEVEL_TRACE)) {
+            LOG_TRACE("起点\t终点\t权重");
+            LOG_TRACE("---------------------");
+
+            for (int i = 0; i < mstEdgeCount; i++) {
+                LOG_TRACE(mstEdgesArray[i].getSrc() << "\t" << mstEdgesArray[i].getDest()
+                    << "\t" << mstEdgesArray[i].getWeight());
+            }
+        }
+        LOG_SUMMARY("总权重: " << totalWeight);
+        // 存储MST总权重
+        mstTotalWeight = totalWeight;
     }
+    else {
+        LOG_SUMMARY("图不连通，无法生成完整的最小生成树");
+        LOG_SUMMARY("只找到了 " << mstEdgeCount << "条边，需要 "<<(vertices - 1) << " 条边");
+        // 存储已找到的边的总权重
+        mstTotalWeight = totalWeight;
+
+    }
+}
+
+/**
+ * @brief 取得工作区中的并查集，并重置为vertices个独立集合
+ * @note 首次调用时分配，此后只重置不重新分配
+ */
+template <typename W>
+UnionFind& BasicGraph<W>::workspaceUnionFind() {
+    if (!workspace.uf) {
+        workspace.uf.reset(new UnionFind(vertices));
+    }
+    else {
+        workspace.uf->reset(vertices);
+    }
+    return *workspace.uf;
+}
+
+/**
+ * @brief 取得并行度为threads的工作区线程池
+ * @note 首次使用或并行度与现有线程池不同时才重建，排序、建边与Borůvka共用同一个线程池
+ */
+template <typename W>
+ThreadPool& BasicGraph<W>::workspacePool(int threads) {
+    if (!workspace.pool || workspace.pool->getThreadCount() != threads) {
+        workspace.pool.reset(new ThreadPool(threads));
+    }
+    return *workspace.pool;
+}
+
+/**
+ * @brief 取得并行排序与建边的线程池
+ * @return 并行度大于1时返回工作区中的线程池（见workspacePool），否则返回nullptr
+ */
+template <typename W>
+ThreadPool* BasicGraph<W>::workerPool() {
+    int threads = workerThreads > 0 ? workerThreads : ThreadPool::hardwareThreads();
+    if (threads <= 1) {
+        return nullptr;
+    }
+    return &workspacePool(threads);
+}
+
+/**
+ * @brief 清空上一次求得的最小生成树
+ */
+template <typename W>
+void BasicGraph<W>::clearMST() {
     mstEdgeCount = 0;
+    mstTotalWeight = 0;
+}
 
-    // 创建边指针数组用于排序（深拷贝）
-    Edge** edges = new Edge * [edgeCount];
-    for (int i = 0; i < edgeCount; i++) {
-        edges[i] = new Edge(*edgesArray[i]);
+/**
+ * @brief 隐式稠密图上的Prim算法求解最小生成树
+ * @note 完全欧氏图无需生成任何边：直接由节点坐标（NodeSet）即时计算距离，
+ *       只维护O(V)的"到生成树最近距离"数组，时间O(V^2)、内存O(V)。
+ *       结果写入mstEdgesArray/mstTotalWeight，与对完全图运行kruskalMST的总权重相同
+ *       （权重按distanceToWeight单调转换，不改变最小生成树）。
+ *       坐标为NaN/无穷的顶点与NodesToEdges一样被跳过；距离平方溢出为无穷时停止扩展，只输出已求得的部分
+ */
+template <typename W>
+void BasicGraph<W>::primMSTImplicit() {
+    LOG_SUMMARY("\n=== 开始执行隐式Prim算法 ===");
+
+    if (mstVersion == version && mstImplicit) {
+        LOG_SUMMARY("图未修改，沿用已求得的最小生成树，总权重: " << mstTotalWeight);
+        return;
     }
+    // 结果对应节点坐标的隐式完全图：getMSTEdges等取值时直接复用，基于边集的算法则重新求解
+    mstVersion = version;
+    mstImplicit = true;
 
-    // 使用堆排序对边按权重排序
-    heapSortEdges(edges, edgeCount);
+    clearMST();
 
-    std::cout << "边按权重排序完成:" << std::endl;
-    for (int i = 0; i < edgeCount; i++) {
-        std::cout << "边 " << i << ": " << edges[i]->getSrc() << " - "
-            << edges[i]->getDest() << " 权重: " << edges[i]->getWeight() << std::endl;
+    if (vertices <= 1) {
+        LOG_SUMMARY("顶点数不足，无法生成最小生成树");
+        return;
     }
 
-    UnionFind uf(vertices);
-    int totalWeight = 0;
+    // 各顶点到当前生成树的最近距离（平方）及对应的树内端点
+    std::vector<double> minDist(vertices, std::numeric_limits<double>::infinity());
+    std::vector<int> nearest(vertices, -1);
+    const double* xCoords = nodes.xData();
+    const double* yCoords = nodes.yData();
 
-    std::cout << "\n开始构建最小生成树:" << std::endl;
+    // 尚未加入生成树的顶点，加入后与末尾交换删除，使内层循环逐轮缩短；坐标无效的顶点不参与
+    std::vector<int> remaining;
+    remaining.reserve(vertices);
+    for (int i = 0; i < vertices; ++i) {
+        if (!std::isfinite(xCoords[i]) || !std::isfinite(yCoords[i])) {
+            std::cerr << "警告：节点 " << i << " 的坐标值无效，跳过" << std::endl;
+            continue;
+        }
+        remaining.push_back(i);
+    }
 
-    // Kruskal算法核心：遍历排序后的边，使用并查集避免环路
-    for (int i = 0; i < edgeCount && mstEdgeCount < vertices - 1; i++) {
-        Edge* currentEdge = edges[i];
-        int u = currentEdge->getSrc();
-        int v = currentEdge->getDest();
+    WeightSum totalWeight = 0;
+    int remainingCount = static_cast<int>(remaining.size());
+    if (remainingCount == 0) {
+        LOG_SUMMARY("没有坐标有效的节点，无法生成最小生成树");
+        return;
+    }
+    int current = remaining[0]; // 从第一个有效顶点开始
+    remaining[0] = remaining[--remainingCount];
 
-        if (uf.find(u) != uf.find(v)) {
-            uf.unite(u, v);
-            mstEdgesArray[mstEdgeCount] = new Edge(*currentEdge);
-            totalWeight += currentEdge->getWeight();
+    while (remainingCount > 0) {
+        const double cx = xCoords[current];
+        const double cy = yCoords[current];
 
-            std::cout << "添加第" << (mstEdgeCount + 1) << "条边: "
-                << u << " - " << v << " 权重: " << currentEdge->getWeight() << std::endl;
-            mstEdgeCount++;
+        // 一次遍历同时完成距离松弛与下一个顶点的选择
+        int bestPos = 0;
+        double bestDist = std::numeric_limits<double>::infinity();
+        for (int k = 0; k < remainingCount; ++k) {
+            int v = remaining[k];
+            double dx = xCoords[v] - cx;
+            double dy = yCoords[v] - cy;
+            double d = dx * dx + dy * dy;
+            if (d < minDist[v]) {
+                minDist[v] = d;
+                nearest[v] = current;
+            }
+            if (minDist[v] < bestDist) {
+                bestDist = minDist[v];
+                bestPos = k;
+            }
         }
-        else {
-            std::cout << "跳过边: " << u << " - " << v
-                << " 权重: " << currentEdge->getWeight() << " (会形成环路)" << std::endl;
+
+        if (!std::isfinite(bestDist)) {
+            // 坐标相距过远，距离平方溢出，剩余顶点无法以有限权重连接
+            std::cerr << "警告：节点间距离溢出，剩余 " << remainingCount << " 个节点未加入生成树" << std::endl;
+            break;
         }
+
+        int next = remaining[bestPos];
+        remaining[bestPos] = remaining[--remainingCount];
+
+        int u = std::min(nearest[next], next);
+        int v = std::max(nearest[next], next);
+        W weight = distanceToWeight(std::sqrt(bestDist));
+        mstEdgesArray[mstEdgeCount++] = EdgeType(u, v, weight);
+        totalWeight += weight;
+
+        current = next;
     }
 
-    // 输出最终结果
-    std::cout << "\n=== Kruskal算法执行完成 ===" << std::endl;
+    mstTotalWeight = totalWeight;
+
+    LOG_SUMMARY("=== 隐式Prim算法执行完成 ===");
+    LOG_SUMMARY("最小生成树包含 " << mstEdgeCount << " 条边，总权重: " << totalWeight);
+}
 
+/**
+ * @brief 使用Filter-Kruskal算法求解最小生成树
+ * @note 围绕枢轴把边划分为轻、重两半，先递归处理轻边；
+ *       处理重边前剔除两端已被并查集连通的边，因此大部分重边从不参与排序。
+ *       几何图中MST边集中在最轻的一小部分，排序工作量远小于全量堆排序。
+ *       在连续边数组的副本上原地划分，不打乱edgesArray；划分层数有上限，递归深度为O(log E)
+ */
+template <typename W>
+void BasicGraph<W>::filterKruskalMST() {
+    LOG_SUMMARY("\n=== 开始执行Filter-Kruskal算法 ===");
+    if (mstVersion == version && !mstImplicit) {
+        LOG_SUMMARY("图未修改，沿用已求得的最小生成树，总权重: " << mstTotalWeight);
+        return;
+    }
+    mstVersion = version; // 以下各分支得到的MST（含空树）均对应当前边集
+    mstImplicit = false;
+
+    const int edgeCount = getEdgeCount();
+
+    clearMST();
+
+    if (edgeCount == 0) {
+        LOG_SUMMARY("图中没有边，无法生成最小生成树");
+        return;
+    }
+
+    if (vertices <= 1) {
+        LOG_SUMMARY("顶点数不足，无法生成最小生成树");
+        return;
+    }
+
+    std::vector<EdgeType>& edges = workspace.sortedEdges;
+    edges.assign(edgesArray.begin(), edgesArray.end());
+    UnionFind& uf = workspaceUnionFind();
+    WeightSum totalWeight = 0;
+    long long sortedCount = 0;
+
+    // 划分层数上限约为2·log2(E)，超出后改为直接排序
+    int depthBudget = 2;
+    for (int m = edgeCount; m > 1; m >>= 1) {
+        depthBudget += 2;
+    }
+    filterKruskal(edges.data(), edgeCount, uf, totalWeight, sortedCount, depthBudget);
+
+    mstTotalWeight = totalWeight;
+
+    LOG_SUMMARY("=== Filter-Kruskal算法执行完成 ===");
+    LOG_SUMMARY("实际排序边数: " << sortedCount << " / " << edgeCount);
     if (mstEdgeCount == vertices - 1) {
-        std::cout << "最小生成树构建成功!" << std::endl;
-        std::cout << "最小生成树包含 " << mstEdgeCount << " 条边:" << std::endl;
-        std::cout << "起点\t终点\t权重" << std::endl;
-        std::cout << "---------------------" << std::endl;
-
-        for (int i = 0; i < mstEdgeCount; i++) {
-            std::cout << mstEdgesArray[i]->getSrc() << "\t" << mstEdgesArray[i]->getDest()
-                << "\t" << mstEdgesArray[i]->getWeight() << std::endl;
-        }
-        std::cout << "总权重: " << totalWeight << std::endl;
-        // 存储MST总权重
-        mstTotalWeight = static_cast<double>(totalWeight);
+        LOG_SUMMARY("最小生成树构建成功，总权重: " << totalWeight);
     }
     else {
-        std::cout << "图不连通，无法生成完整的最小生成树" << std::endl;
-        std::cout << "只找到了 " << mstEdgeCount << "条边，需要 "<<(vertices - 1) << " 条边" << std::endl;
-        // 存储已找到的边的总权重
-        mstTotalWeight = static_cast<double>(totalWeight);
+        LOG_SUMMARY("图不连通，只找到了 " << mstEdgeCount << " 条边，需要 " << (vertices - 1) << " 条边");
+    }
+}
+
+/**
+ * @brief Filter-Kruskal的递归过程
+ * @param edges 待处理的边区间
+ * @param n 区间长度
+ * @param uf 全局并查集
+ * @param totalWeight 累计MST权重
+ * @param sortedCount 累计参与排序的边数（统计用）
+ * @param depthBudget 剩余划分层数；耗尽后区间直接排序扫描
+ * @note 只对轻边递归，重边过滤后在循环中继续划分，且每次划分都消耗depthBudget，
+ *       因此递归深度不超过初始预算（约2·log2(E)）；枢轴持续失衡（大量重复边权等）时
+ *       退化为对剩余区间堆排序，最坏仍为O(E log E)，不会栈溢出
+ */
+template <typename W>
+void BasicGraph<W>::filterKruskal(EdgeType edges[], int n, UnionFind& uf, WeightSum& totalWeight,
+                                  long long& sortedCount, int depthBudget) {
+    const int SORT_THRESHOLD = 1024; // 小区间直接排序
+
+    while (mstEdgeCount < vertices - 1 && n > 0) {
+        if (n <= SORT_THRESHOLD || depthBudget <= 0) {
+            heapSortEdges(edges, n);
+            sortedCount += n;
+            for (int i = 0; i < n && mstEdgeCount < vertices - 1; i++) {
+                int u = edges[i].getSrc();
+                int v = edges[i].getDest();
+                if (uf.find(u) != uf.find(v)) {
+                    uf.unite(u, v);
+                    mstEdgesArray[mstEdgeCount++] = edges[i];
+                    totalWeight += edges[i].getWeight();
+                }
+            }
+            return;
+        }
+        depthBudget--;
+
+        // 三数取中选择枢轴；边按edgeLess互不相等，保证两侧都非空
+        const EdgeType& a = edges[0];
+        const EdgeType& b = edges[n / 2];
+        const EdgeType& c = edges[n - 1];
+        EdgeType pivotEdge;
+        if (edgeLess(a, b)) {
+            pivotEdge = edgeLess(b, c) ? b : (edgeLess(a, c) ? c : a);
+        }
+        else {
+            pivotEdge = edgeLess(a, c) ? a : (edgeLess(b, c) ? c : b);
+        }
+
+        // 划分：[0, lightCount) 严格轻于枢轴，其余为重边
+        EdgeType* mid = std::partition(edges, edges + n,
+            [&pivotEdge](const EdgeType& e) { return edgeLess(e, pivotEdge); });
+        int lightCount = static_cast<int>(mid - edges);
+
+        filterKruskal(edges, lightCount, uf, totalWeight, sortedCount, depthBudget);
 
+        if (mstEdgeCount >= vertices - 1) {
+            return;
+        }
+
+        // 过滤：两端已连通的重边不可能进入MST，直接丢弃；剩余重边在本层循环中继续处理
+        EdgeType* keptEnd = std::partition(mid, edges + n,
+            [&uf](const EdgeType& e) { return !uf.isConnected(e.getSrc(), e.getDest()); });
+        edges = mid;
+        n = static_cast<int>(keptEnd - mid);
     }
+}
 
-    // 释放内存
-    for (int i = 0; i < edgeCount; i++) {
-        delete edges[i];
+/**
+ * @brief 使用并行Borůvka算法求解最小生成树
+ * @param threadCount 并行线程数，<=0 时取硬件并发数
+ * @note 每轮：
+ *       1. 并行记录每个顶点当前所属连通分量（无锁并查集的根）
+ *       2. 并行扫描存活边，用CAS为每个分量维护edgeLess意义下的最小出边，
+ *          并在各边段内原地剔除已落入同一分量的边
+ *       3. 并行合并各分量的最小出边（ConcurrentUnionFind）；两个分量选中同一条边时
+ *          只有一次unite成功，其余最小出边两两不成环，必然都能合并
+ *       至多O(log V)轮。由于edgeLess是全序，最小生成树唯一，
+ *       结果（按edgeLess排序后）与kruskalMST的getMSTEdges()完全一致
+ */
+template <typename W>
+void BasicGraph<W>::boruvkaMST(int threadCount) {
+    LOG_SUMMARY("\n=== 开始执行并行Borůvka算法 ===");
+    if (mstVersion == version && !mstImplicit) {
+        LOG_SUMMARY("图未修改，沿用已求得的最小生成树，总权重: " << mstTotalWeight);
+        return;
+    }
+    mstVersion = version; // 以下各分支得到的MST（含空树）均对应当前边集
+    mstImplicit = false;
+
+    const int edgeCount = getEdgeCount();
+
+    clearMST();
+
+    if (edgeCount == 0) {
+        LOG_SUMMARY("图中没有边，无法生成最小生成树");
+        return;
+    }
+
+    if (vertices <= 1) {
+        LOG_SUMMARY("顶点数不足，无法生成最小生成树");
+        return;
+    }
+
+    // 复用工作区线程池，线程数与上次不同时才重建
+    ThreadPool& pool = workspacePool(threadCount > 0 ? threadCount : ThreadPool::hardwareThreads());
+    ConcurrentUnionFind uf(vertices);
+
+    // 存活边下标按固定分段，各段独立并行压缩
+    std::vector<int> alive(edgeCount);
+    for (int i = 0; i < edgeCount; ++i) {
+        alive[i] = i;
+    }
+    int segmentCount = std::max(1, std::min(edgeCount, pool.getThreadCount() * 8));
+    std::vector<int> segmentBegin(segmentCount);
+    std::vector<int> segmentSize(segmentCount);
+    for (int s = 0; s < segmentCount; ++s) {
+        long long b = static_cast<long long>(edgeCount) * s / segmentCount;
+        long long e = static_cast<long long>(edgeCount) * (s + 1) / segmentCount;
+        segmentBegin[s] = static_cast<int>(b);
+        segmentSize[s] = static_cast<int>(e - b);
+    }
+
+    std::vector<int> component(vertices);
+    std::vector<std::atomic<int>> cheapest(vertices);
+    std::atomic<int> selectedCount(0);
+
+    int round = 0;
+    bool merged = true;
+
+    while (merged && mstEdgeCount < vertices - 1) {
+        round++;
+
+        // 1. 当前分量快照（本轮合并开始前各顶点的根）
+        std::atomic<int> componentCount(0);
+        pool.parallelFor(0, vertices, 0, [&](int first, int last) {
+            int localRoots = 0;
+            for (int v = first; v < last; ++v) {
+                component[v] = uf.find(v);
+                if (component[v] == v) {
+                    localRoots++;
+                }
+                cheapest[v].store(-1, std::memory_order_relaxed);
+            }
+            componentCount.fetch_add(localRoots, std::memory_order_relaxed);
+        });
+
+        // 2. 并行查找每个分量的最小出边，同时剔除分量内部的边
+        pool.parallelFor(0, segmentCount, 1, [&](int segFirst, int segLast) {
+            for (int s = segFirst; s < segLast; ++s) {
+                int* seg = alive.data() + segmentBegin[s];
+                int kept = 0;
+                for (int k = 0; k < segmentSize[s]; ++k) {
+                    int idx = seg[k];
+                    const EdgeType& edge = edgesArray[idx];
+                    int cu = component[edge.getSrc()];
+                    int cv = component[edge.getDest()];
+                    if (cu == cv) {
+                        continue; // 已在同一分量内，永久淘汰
+                    }
+                    seg[kept++] = idx;
+
+                    for (int c : { cu, cv }) {
+                        int current = cheapest[c].load(std::memory_order_relaxed);
+                        while ((current == -1 || edgeLess(edge, edgesArray[current])) &&
+                            !cheapest[c].compare_exchange_weak(current, idx, std::memory_order_relaxed)) {
+                        }
+                    }
+                }
+                segmentSize[s] = kept;
+            }
+        });
+
+        // 3. 并行合并：选中的边按完成顺序写入MST数组
+        int selectedBefore = selectedCount.load(std::memory_order_relaxed);
+        pool.parallelFor(0, vertices, 0, [&](int first, int last) {
+            for (int r = first; r < last; ++r) {
+                if (component[r] != r) {
+                    continue;
+                }
+                int idx = cheapest[r].load(std::memory_order_relaxed);
+                if (idx == -1) {
+                    continue;
+                }
+                const EdgeType& edge = edgesArray[idx];
+                if (uf.unite(edge.getSrc(), edge.getDest())) {
+                    mstEdgesArray[selectedCount.fetch_add(1, std::memory_order_relaxed)] = edge;
+                }
+            }
+        });
+        mstEdgeCount = selectedCount.load(std::memory_order_relaxed);
+        merged = mstEdgeCount > selectedBefore;
+
+        LOG_TRACE("第" << round << "轮：分量数 " << componentCount.load(std::memory_order_relaxed)
+            << "，已选边 " << mstEdgeCount);
     }
-    delete[] edges;
+
+    // 按edgeLess排序，使输出顺序与kruskalMST一致；按排序后顺序累加，浮点总权重与kruskalMST相同
+    std::sort(mstEdgesArray.begin(), mstEdgesArray.begin() + mstEdgeCount, edgeLess);
+
+    WeightSum totalWeight = 0;
+    for (int i = 0; i < mstEdgeCount; ++i) {
+        totalWeight += mstEdgesArray[i].getWeight();
+    }
+    mstTotalWeight = totalWeight;
+
+    LOG_SUMMARY("=== 并行Borůvka算法执行完成（" << pool.getThreadCount() << " 线程，"
+        << round << " 轮）===");
+    if (mstEdgeCount == vertices - 1) {
+        LOG_SUMMARY("最小生成树构建成功，总权重: " << totalWeight);
+    }
+    else {
+        LOG_SUMMARY("图不连通，只找到了 " << mstEdgeCount << " 条边，需要 " << (vertices - 1) << " 条边");
+    }
+}
+
+/**
+ * @brief 将欧氏距离转换为边权
+ * @param distance 非负距离
+ * @return 整数边权截断（默认，与NodesToEdges一致）或四舍五入（GraphFileIO读入的图）；
+ *         浮点边权保留精确距离
+ */
+template <typename W>
+W BasicGraph<W>::distanceToWeight(double distance) const {
+    return WeightTraits<W>::fromDistance(distance, roundDistances);
 }
 
 // 获取节点X坐标
-double Graph::getNodeX(int index) const {
+template <typename W>
+double BasicGraph<W>::getNodeX(int index) const {
     if (index >= 0 && index < vertices) {
-        return xCoords[index];
+        return nodes.getX(index);
     }
     return 0.0;
 }
 
 // 获取节点Y坐标
-double Graph::getNodeY(int index) const {
+template <typename W>
+double BasicGraph<W>::getNodeY(int index) const {
     if (index >= 0 && index < vertices) {
-        return yCoords[index];
+        return nodes.getY(index);
     }
     return 0.0;
 }
 
 // 设置节点坐标
-void Graph::setNodeCoordinates(int index, double x, double y) {
+template <typename W>
+void BasicGraph<W>::setNodeCoordinates(int index, double x, double y) {
     if (index >= 0 && index < vertices) {
-        xCoords[index] = x;
-        yCoords[index] = y;
+        nodes.set(index, x, y);
+        version++;
+    }
+}
+
+// 移动接管全部节点坐标；大小与顶点数不一致时不修改并返回false
+template <typename W>
+bool BasicGraph<W>::setNodes(NodeSet&& nodeSet) {
+    if (nodeSet.size() != vertices) {
+        std::cerr << "错误：节点集大小 " << nodeSet.size() << " 与顶点数 " << vertices << " 不一致" << std::endl;
+        return false;
     }
-}
\ No newline at end of file
+    nodes = std::move(nodeSet);
+    version++;
+    return true;
+}
+
+// 显式实例化：成员函数定义留在本文件，四种边权类型各生成一份
+template class BasicGraph<int>;
+template class BasicGraph<long long>;
+template class BasicGraph<float>;
+template class BasicGraph<double>;
+
+template void NodesToEdges<int>(BasicGraph<int>&, Node*[], int, EdgeBuildMode);
+template void NodesToEdges<long long>(BasicGraph<long long>&, Node*[], int, EdgeBuildMode);
+template void NodesToEdges<float>(BasicGraph<float>&, Node*[], int, EdgeBuildMode);
+template void NodesToEdges<double>(BasicGraph<double>&, Node*[], int, EdgeBuildMode);
+
+template void NodesToEdges<int>(BasicGraph<int>&, EdgeBuildMode);
+template void NodesToEdges<long long>(BasicGraph<long long>&, EdgeBuildMode);
+template void NodesToEdges<float>(BasicGraph<float>&, EdgeBuildMode);
+template void NodesToEdges<double>(BasicGraph<double>&, EdgeBuildMode);
@@ -2,58 +2,176 @@
 #define GRAPH_H
 
 #include "Edge.h"
+#include "EdgeIndex.h"
+#include "NodeSet.h"
+#include "WeightTraits.h"
 #include <cmath>
+#include <cstdint>
+#include <memory>
 #include <vector>
 class UnionFind; // 前向声明
 class Node;
-class Graph {
+class ThreadPool;
+
+// 由节点坐标生成边的方式
+enum class EdgeBuildMode {
+    Complete,  // 完全图：所有节点两两连边，O(V^2)条边
+    Delaunay,  // Delaunay三角剖分：O(V)条候选边，且包含欧氏最小生成树
+    KNearest,  // kd树k近邻 + 最近异分量补边：O(kV)条候选边，且包含欧氏最小生成树
+    Manhattan,  // 曼哈顿距离：四扇区扫描得到至多4V条候选边，权重为L1距离，包含L1最小生成树
+    SpatialGrid // 均匀网格：只连相邻方格内的近邻点，未连通的分量再扩大半径，包含欧氏最小生成树
+};
+
+/**
+ * @brief 图类模板，W为边权类型（int、long long、float、double，见WeightTraits.h）
+ * @note 成员函数在Graph.cpp中实现并对四种边权类型显式实例化；
+ *       kruskalMST的基数排序按WeightTraits<W>::Key排序，整数与浮点边权均为线性时间
+ */
+template <typename W>
+class BasicGraph {
+public:
+    typedef W WeightType;
+    typedef BasicEdge<W> EdgeType;
+    typedef typename WeightTraits<W>::Key KeyType;   // 基数排序键
+    typedef typename WeightTraits<W>::Sum WeightSum; // MST总权重类型
+
 private:
     int vertices;     // 顶点数量
     int** adjMatrix;  // 邻接矩阵
-    Edge** edgesArray; // 边数组
-    int edgeCount;    // 当前边数
+    std::vector<EdgeType> edgesArray; // 边数组（连续存储，按需增长）
+    EdgeIndex edgeIndex;          // (u<v)顶点对 -> 边下标的哈希索引，与edgesArray同步
     int maxEdges;     // 最大边数
     // MST相关
-    Edge** mstEdgesArray; // 最小生成树边数组
+    std::vector<EdgeType> mstEdgesArray; // 最小生成树边数组（预分配vertices-1条）
     int mstEdgeCount;    // MST边数
-    double mstTotalWeight; // MST总权重
+    WeightSum mstTotalWeight; // MST总权重（整数边权按64位累加）
     // 节点坐标
-    std::vector<double> xCoords; // 节点X坐标
-    std::vector<double> yCoords; // 节点Y坐标
+    NodeSet nodes;               // 节点坐标（SoA连续存储，顶点i对应第i个节点）
+    bool roundDistances;         // 距离转权重时四舍五入（true）或截断（false）
+    int candidateNeighbors;      // KNearest建边时每个节点的近邻数k
+    uint64_t version;            // 修改版本号：加边、改权重、改坐标、加顶点时递增
+    uint64_t mstVersion;         // mstEdgesArray对应的版本号，与version相等时MST结果可直接复用
+    bool mstImplicit;            // MST由primMSTImplicit按坐标求得（对应隐式完全图而非当前边集）
+    int workerThreads;           // 排序与完全图建边的线程数：<=0为硬件并发数，1为串行
+
+    // 基数排序的辅助缓冲区（并行排序时每块一份）
+    struct RadixScratch {
+        std::vector<int> tmpOrder;       // 辅助排列
+        std::vector<KeyType> keys;       // 当前键
+        std::vector<KeyType> tmpKeys;    // 辅助键
+        std::vector<int> counts;         // 桶计数
+    };
+
+    // Kruskal求解的可复用工作区：首次求解后各缓冲区保留容量，重复求解不再分配堆内存
+    struct KruskalWorkspace {
+        std::vector<EdgeType> sortedEdges; // 排序后的边
+        std::vector<int> order;          // 基数排序输出的边下标排列
+        RadixScratch radix;              // 串行基数排序缓冲区
+        std::vector<RadixScratch> chunkRadix; // 并行基数排序各块的缓冲区
+        std::vector<int> mergeOrder;     // 并行归并下标排列的辅助数组
+        std::vector<EdgeType> mergeEdges; // 并行归并边数组的辅助数组
+        std::vector<int> mergeRuns;      // 并行归并各有序段的边界
+        std::unique_ptr<ThreadPool> pool; // 并行排序、建边与Borůvka的线程池（按需创建）
+        std::unique_ptr<UnionFind> uf;   // 并查集（reset复用）
+    };
+    KruskalWorkspace workspace;
+    // 取得已重置为vertices个集合的工作区并查集
+    UnionFind& workspaceUnionFind();
     // 堆排序相关函数
-    void heapify(Edge* edges[], int n, int i) const;
-    void buildHeap(Edge* edges[], int n)const;
+    void heapify(EdgeType edges[], int n, int i) const;
+    void buildHeap(EdgeType edges[], int n)const;
+    void heapSortRange(EdgeType edges[], int n) const;   // 串行堆排序
+    void radixSortEdgeRange(int order[], int n, RadixScratch& scratch) const; // 串行基数排序一段边下标
+    ThreadPool& workspacePool(int threads); // 工作区线程池，首次使用或并行度变化时重建
+    ThreadPool* workerPool(); // 并行排序与建边所用线程池，并行度为1时返回nullptr
+    // 清空上一次求得的MST
+    void clearMST();
+    // Filter-Kruskal递归：先处理轻边，重边在排序前用并查集过滤；depthBudget为剩余划分层数
+    void filterKruskal(EdgeType edges[], int n, UnionFind& uf, WeightSum& totalWeight, long long& sortedCount,
+                       int depthBudget);
 
 public:
     static const int INF = 2147483647; // 无穷大表示
+    static const int RADIX_SORT_THRESHOLD = 4096; // 边数达到该值时kruskalMST改用基数排序
+    static const int PARALLEL_SORT_THRESHOLD = 1 << 16; // 元素数达到该值时排序改用多线程归并
+    static const int PARALLEL_BUILD_THRESHOLD = 1 << 16; // 边数达到该值时addCompleteEdges改用多线程
+    static const int DEFAULT_CANDIDATE_NEIGHBORS = 8; // KNearest建边的默认近邻数
+
+    // 边的全序：先比较权重，权重相同时依次比较src、dest，使各MST算法得到同一棵树
+    static bool edgeLess(const EdgeType& a, const EdgeType& b) {
+        if (a.getWeight() != b.getWeight()) return a.getWeight() < b.getWeight();
+        if (a.getSrc() != b.getSrc()) return a.getSrc() < b.getSrc();
+        return a.getDest() < b.getDest();
+    }
 
-    Graph(int v);
-    ~Graph();
+    BasicGraph(int v);
+    explicit BasicGraph(NodeSet&& nodeSet); // 以节点集的大小为顶点数，并移动接管其坐标
+    ~BasicGraph();
 
     // 图操作
-    void addEdge(int u, int v, int weight);
+    void addEdge(int u, int v, W weight);
+    void addUniqueEdge(int u, int v, W weight);   // 调用方保证边不重复，跳过查重
+    void reserveEdges(int n);                     // 预留边数组容量
+    bool addCompleteEdges(const int* vertexIds, const double* xs, const double* ys, int n); // 批量添加完全图的边（见Graph.cpp）
+    int addVertex(double x, double y);            // 追加顶点并连向所有已有顶点，增量更新MST，返回新顶点下标（坐标无效时返回-1）
     void printGraph() const;
     bool hasEdge(int u, int v) const;
+    int findEdge(int u, int v) const;             // 边u-v在getEdges()中的下标，不存在时为-1
+
+    // 算法实现（排序与求解都写入工作区缓冲区，因此不是const，同一个图不能被多个线程同时调用）
+    void heapSortEdges(EdgeType edges[], int n);
+    void radixSortEdgeOrder(std::vector<int>& order); // LSD基数排序，输出按edgeLess排好序的边下标
 
-    // 算法实现
-    void heapSortEdges(Edge* edges[], int n) const;
+    // 排序与完全图建边的并行度（heapSortEdges、radixSortEdgeOrder、addCompleteEdges共用）：
+    // <=0为硬件并发数（默认），1为串行；并行与串行结果完全相同
+    void setWorkerThreads(int threads) { workerThreads = threads; }
+    int getWorkerThreads() const { return workerThreads; }
     void kruskalMST();
+    void primMSTImplicit(); // 稠密Prim：按坐标即时计算距离，不生成边，O(V^2)时间、O(V)内存
+    void boruvkaMST(int threadCount = 0); // 并行Borůvka：各连通分量并行查找最小出边，按轮合并
+    void filterKruskalMST();              // Filter-Kruskal：按枢轴划分边，只对需要的轻边排序
 
     // 辅助函数
     int getVertices() const { return vertices; }
-    int getEdgeCount() const { return edgeCount; }
-    Edge** getEdges() const { return edgesArray; }
-    Edge** getMSTEdges() const { return mstEdgesArray; }
-    int getMSTEdgeCount() const { return mstEdgeCount; }
-    double getMSTTotalWeight() const { return mstTotalWeight; } // 获取MST总权重
+    int getEdgeCount() const { return static_cast<int>(edgesArray.size()); }
+    const EdgeType* getEdges() const { return edgesArray.data(); }
+    // MST取值：版本号未变时直接返回缓存的结果，图修改后（或从未求解时）先按当前边集运行kruskalMST
+    const EdgeType* getMSTEdges() { ensureMST(); return mstEdgesArray.data(); }
+    int getMSTEdgeCount() { ensureMST(); return mstEdgeCount; }
+    WeightSum getMSTTotalWeight() { ensureMST(); return mstTotalWeight; } // 获取MST总权重
+    uint64_t getVersion() const { return version; }  // 当前修改版本号（单调递增）
+    bool isMSTCurrent() const { return mstVersion == version; } // MST是否对应当前图（修改后需重新求解）
+    void ensureMST() { if (!isMSTCurrent()) kruskalMST(); }  // 缓存过期时重新求解
+    void invalidateMST() { mstVersion = 0; }          // 丢弃缓存，下次求解强制重新计算（基准测试用）
     
     // 节点坐标方法
     double getNodeX(int index) const; // 获取节点X坐标
     double getNodeY(int index) const; // 获取节点Y坐标
     void setNodeCoordinates(int index, double x, double y); // 设置节点坐标
+    bool setNodes(NodeSet&& nodeSet);                        // 移动接管全部节点坐标（大小须等于顶点数）
+    const NodeSet& getNodes() const { return nodes; }       // 全部节点坐标（连续数组）
+
+    // 距离到整数权重的转换
+    void setRoundDistances(bool round) { roundDistances = round; } // 设置四舍五入或截断（仅整数边权）
+    W distanceToWeight(double distance) const;                      // 按当前方式转换距离
+
+    // KNearest建边的近邻数k（至少为1）
+    void setCandidateNeighbors(int k) { candidateNeighbors = k < 1 ? 1 : k; }
+    int getCandidateNeighbors() const { return candidateNeighbors; }
 };
 
+// 默认的整数边权图；其余实例化供需要更大范围或精确距离的场景使用
+using Graph = BasicGraph<int>;
+using Int64Graph = BasicGraph<long long>;
+using FloatGraph = BasicGraph<float>;
+using DoubleGraph = BasicGraph<double>;
+
 // 外部函数声明
-void NodesToEdges(Graph& graph, Node* nodes[], int nodes_n);
+template <typename W>
+void NodesToEdges(BasicGraph<W>& graph, Node* nodes[], int nodes_n,
+                  EdgeBuildMode mode = EdgeBuildMode::Complete);
+// 按图中已保存的节点坐标建边（配合BasicGraph(NodeSet&&)使用）
+template <typename W>
+void NodesToEdges(BasicGraph<W>& graph, EdgeBuildMode mode = EdgeBuildMode::Complete);
 
 #endif
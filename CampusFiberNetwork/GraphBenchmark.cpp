@@ -0,0 +1,466 @@
+/**
+ * @file GraphBenchmark.cpp
+ * @brief 图核心模块基准测试程序（不依赖Qt）
+ *
+ * 在带种子的合成点集（均匀分布、聚簇分布、共线分布）上计时
+ * NodesToEdges、heapSortEdges、kruskalMST、UnionFind::find/unite 与
+ * GraphFileIO::readNodesAndBuildGraph，每个测量结果输出一行JSON（JSON Lines），
+ * 便于跨版本对比回归。
+ *
+ * 用法：
+ *   GraphBenchmark [--sizes 1000,10000,100000,1000000] [--complete-max 2000]
+ *                  [--repeat 3] [--seed 42] [--out result.jsonl]
+ *   GraphBenchmark --verify [--seed 42]
+ *
+ * 完全图的边数为O(V^2)，节点数超过 --complete-max 时只测候选边模式（Delaunay、k近邻、曼哈顿、网格）。
+ * 输出字段：
+ *   bench, dist, mode, edges, nodes, ops, iterations, seed,
+ *   ns_per_op（最快一次迭代）, mean_ns_per_op, edges_per_sec, peak_rss_kb, simd
+ * 其中一次操作（op）对图算法指处理一条边，对UnionFind指一次find/unite组合。
+ * peak_rss_kb为进程截至该测量结束时的峰值常驻内存；simd为完全图建边所用的距离内核实现。
+ *
+ * --verify 不计时，只做回归检查：在退化点集（坐标不精确的共线点、大量重合点、整数格点、共圆点）上
+ * 比较各欧氏候选边模式与完全图的MST（DoubleGraph，边数与总权重），不一致时输出到标准错误并返回2。
+ */
+
+#include "BenchmarkUtil.h"
+#include "DistanceKernel.h"
+#include "Graph.h"
+#include "GraphFileIO.h"
+#include "Logger.h"
+#include "NodeSet.h"
+#include "UnionFind.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Benchmark::Clock;
+using Benchmark::JsonFields;
+using Benchmark::Measurement;
+using Benchmark::Reporter;
+using Benchmark::SeededRandom;
+using Benchmark::elapsedNs;
+using Benchmark::peakRssKb;
+
+// 点集分布类型
+enum class Distribution {
+    Uniform,   // 正方形内均匀分布
+    Clustered, // 围绕若干中心的高斯聚簇
+    Collinear  // 位于直线y=x上（同collinear_nodes.txt）
+};
+
+const char* distributionName(Distribution dist) {
+    switch (dist) {
+    case Distribution::Uniform: return "uniform";
+    case Distribution::Clustered: return "clustered";
+    case Distribution::Collinear: return "collinear";
+    }
+    return "unknown";
+}
+
+const char* modeName(EdgeBuildMode mode) {
+    switch (mode) {
+    case EdgeBuildMode::Complete: return "complete";
+    case EdgeBuildMode::Delaunay: return "delaunay";
+    case EdgeBuildMode::KNearest: return "knearest";
+    case EdgeBuildMode::Manhattan: return "manhattan";
+    case EdgeBuildMode::SpatialGrid: return "grid";
+    }
+    return "unknown";
+}
+
+struct PointSet {
+    std::vector<double> xs;
+    std::vector<double> ys;
+};
+
+/**
+ * @brief 生成n个点
+ * @note 区域边长随sqrt(n)增长，使相邻点的平均间距约为10个单位，
+ *       保证整数权重在各规模下都有区分度
+ */
+PointSet generatePoints(Distribution dist, int n, uint64_t seed) {
+    PointSet points;
+    points.xs.resize(n);
+    points.ys.resize(n);
+    SeededRandom rng(seed);
+    double side = 10.0 * std::sqrt(static_cast<double>(n));
+
+    switch (dist) {
+    case Distribution::Uniform:
+        for (int i = 0; i < n; i++) {
+            points.xs[i] = (rng.uniform() - 0.5) * side;
+            points.ys[i] = (rng.uniform() - 0.5) * side;
+        }
+        break;
+    case Distribution::Clustered: {
+        int clusters = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(n)) / 4));
+        std::vector<double> cx(clusters), cy(clusters);
+        for (int c = 0; c < clusters; c++) {
+            cx[c] = (rng.uniform() - 0.5) * side;
+            cy[c] = (rng.uniform() - 0.5) * side;
+        }
+        double spread = side / (4.0 * std::sqrt(static_cast<double>(clusters)));
+        for (int i = 0; i < n; i++) {
+            int c = rng.below(clusters);
+            points.xs[i] = cx[c] + rng.gaussian() * spread;
+            points.ys[i] = cy[c] + rng.gaussian() * spread;
+        }
+        break;
+    }
+    case Distribution::Collinear:
+        for (int i = 0; i < n; i++) {
+            double t = (rng.uniform() - 0.5) * side;
+            points.xs[i] = t;
+            points.ys[i] = t;
+        }
+        break;
+    }
+    return points;
+}
+
+// 图基准的一项测量：在公共部分之外记录点集分布、建边模式与边数
+struct GraphMeasurement : Measurement {
+    const char* dist;
+    const char* mode;
+    long long edges;      // 本项涉及的边数（UnionFind为0）
+};
+
+void report(Reporter& reporter, const GraphMeasurement& m) {
+    long long best = m.bestNs();
+    double edgesPerSec = (best > 0 && m.edges > 0) ? m.edges * 1e9 / best : 0.0;
+    reporter.report(m,
+        JsonFields().addString("dist", m.dist).addString("mode", m.mode).addInt("edges", m.edges),
+        JsonFields().addFixed("edges_per_sec", edgesPerSec, 1).addInt("peak_rss_kb", peakRssKb())
+            .addString("simd", DistanceKernel::instructionSet()));
+}
+
+struct Options {
+    std::vector<int> sizes{1000, 10000, 100000, 1000000};
+    int completeMax = 2000;
+    int repeat = 3;
+    uint64_t seed = 42;
+    std::string outPath;
+    bool verify = false;
+};
+
+bool parseSizes(const char* text, std::vector<int>& sizes) {
+    sizes.clear();
+    std::string s(text);
+    size_t pos = 0;
+    while (pos <= s.size()) {
+        size_t comma = s.find(',', pos);
+        if (comma == std::string::npos) comma = s.size();
+        long value = std::strtol(s.substr(pos, comma - pos).c_str(), nullptr, 10);
+        if (value < 2 || value > 10000000) return false;
+        sizes.push_back(static_cast<int>(value));
+        pos = comma + 1;
+    }
+    return !sizes.empty();
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--sizes") == 0 && hasValue) {
+            if (!parseSizes(argv[++i], options.sizes)) return false;
+        }
+        else if (std::strcmp(arg, "--complete-max") == 0 && hasValue) {
+            options.completeMax = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(arg, "--repeat") == 0 && hasValue) {
+            options.repeat = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (std::strcmp(arg, "--out") == 0 && hasValue) {
+            options.outPath = argv[++i];
+        }
+        else if (std::strcmp(arg, "--verify") == 0) {
+            options.verify = true;
+        }
+        else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// NodesToEdges所需的节点坐标
+NodeSet makeNodeSet(const PointSet& points) {
+    int n = static_cast<int>(points.xs.size());
+    NodeSet nodes;
+    nodes.reserve(n);
+    for (int i = 0; i < n; i++) {
+        nodes.add(points.xs[i], points.ys[i]);
+    }
+    return nodes;
+}
+
+// NodesToEdges：每次迭代由节点集的副本重新建图，只计转换本身
+GraphMeasurement benchNodesToEdges(const NodeSet& nodes, Distribution dist, EdgeBuildMode mode, int repeat) {
+    int n = nodes.size();
+    GraphMeasurement m{{"NodesToEdges", n, 0, {}}, distributionName(dist), modeName(mode), 0};
+    for (int r = 0; r < repeat; r++) {
+        Graph graph{NodeSet(nodes)};
+        Clock::time_point start = Clock::now();
+        NodesToEdges(graph, mode);
+        Clock::time_point end = Clock::now();
+        m.edges = graph.getEdgeCount();
+        m.iterationNs.push_back(elapsedNs(start, end));
+    }
+    m.ops = m.edges;
+    return m;
+}
+
+// heapSortEdges：每次迭代对边数组的同一份拷贝排序
+GraphMeasurement benchHeapSort(Graph& graph, Distribution dist, EdgeBuildMode mode, int repeat) {
+    int edgeCount = graph.getEdgeCount();
+    GraphMeasurement m{{"heapSortEdges", graph.getVertices(), edgeCount, {}}, distributionName(dist), modeName(mode), edgeCount};
+    std::vector<Edge> edges;
+    for (int r = 0; r < repeat; r++) {
+        edges.assign(graph.getEdges(), graph.getEdges() + edgeCount);
+        Clock::time_point start = Clock::now();
+        graph.heapSortEdges(edges.data(), edgeCount);
+        Clock::time_point end = Clock::now();
+        m.iterationNs.push_back(elapsedNs(start, end));
+    }
+    return m;
+}
+
+// kruskalMST：先预热一次使工作区分配完毕，测量稳态求解；每次迭代前丢弃MST缓存，强制重新计算
+GraphMeasurement benchKruskal(Graph& graph, Distribution dist, EdgeBuildMode mode, int repeat) {
+    int edgeCount = graph.getEdgeCount();
+    GraphMeasurement m{{"kruskalMST", graph.getVertices(), edgeCount, {}}, distributionName(dist), modeName(mode), edgeCount};
+    graph.kruskalMST();
+    for (int r = 0; r < repeat; r++) {
+        graph.invalidateMST();
+        Clock::time_point start = Clock::now();
+        graph.kruskalMST();
+        Clock::time_point end = Clock::now();
+        m.iterationNs.push_back(elapsedNs(start, end));
+    }
+    return m;
+}
+
+// UnionFind：n次随机顶点对的"find判断 + unite"组合，与点集分布无关
+GraphMeasurement benchUnionFind(int n, uint64_t seed, int repeat) {
+    SeededRandom rng(seed ^ 0x5DEECE66DULL);
+    std::vector<int> pairs(2 * static_cast<size_t>(n));
+    for (size_t i = 0; i < pairs.size(); i++) pairs[i] = rng.below(n);
+
+    GraphMeasurement m{{"UnionFind", n, n, {}}, "random_pairs", "-", 0};
+    UnionFind uf(n);
+    long long merges = 0;
+    for (int r = 0; r < repeat; r++) {
+        uf.reset(n);
+        merges = 0;
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < n; i++) {
+            int a = pairs[2 * i];
+            int b = pairs[2 * i + 1];
+            if (uf.find(a) != uf.find(b)) {
+                uf.unite(a, b);
+                merges++;
+            }
+        }
+        Clock::time_point end = Clock::now();
+        m.iterationNs.push_back(elapsedNs(start, end));
+    }
+    if (merges < 0) std::cerr << merges; // 防止循环被整体优化掉
+    return m;
+}
+
+// GraphFileIO：把点集写入临时文件，测量读文件并建图
+GraphMeasurement benchFileIO(const PointSet& points, Distribution dist, EdgeBuildMode mode,
+                             uint64_t seed, int repeat) {
+    int n = static_cast<int>(points.xs.size());
+    GraphMeasurement m{{"readNodesAndBuildGraph", n, 0, {}}, distributionName(dist), modeName(mode), 0};
+
+    std::error_code ec;
+    std::filesystem::path path = std::filesystem::temp_directory_path(ec);
+    if (ec) path = ".";
+    path /= "cfn_bench_" + std::to_string(seed) + "_" + distributionName(dist) + "_"
+        + std::to_string(n) + ".txt";
+    {
+        std::ofstream file(path);
+        if (!file) {
+            std::cerr << "错误：无法写入临时文件 " << path.string() << std::endl;
+            return m;
+        }
+        char line[96];
+        file << n << '\n';
+        for (int i = 0; i < n; i++) {
+            std::snprintf(line, sizeof(line), "%.3f %.3f\n", points.xs[i], points.ys[i]);
+            file << line;
+        }
+    }
+
+    std::string filename = path.string();
+    for (int r = 0; r < repeat; r++) {
+        Graph graph(n);
+        Clock::time_point start = Clock::now();
+        bool ok = GraphFileIO::readNodesAndBuildGraph(graph, filename.c_str(), mode);
+        Clock::time_point end = Clock::now();
+        if (!ok) {
+            std::cerr << "错误：读取临时文件失败 " << filename << std::endl;
+            m.iterationNs.clear();
+            break;
+        }
+        m.edges = graph.getEdgeCount();
+        m.iterationNs.push_back(elapsedNs(start, end));
+    }
+    m.ops = m.edges;
+    std::filesystem::remove(path, ec);
+    return m;
+}
+
+// 退化点集：k取[0, distinct)内的随机整数，点(0.1k, 0.3k+1)不在精确的直线上，且大量重合
+NodeSet inexactCollinearNodes(int n, int distinct, SeededRandom& rng) {
+    NodeSet nodes;
+    nodes.reserve(n);
+    for (int i = 0; i < n; i++) {
+        int k = rng.below(distinct);
+        nodes.add(0.1 * k, 0.3 * k + 1);
+    }
+    return nodes;
+}
+
+// 退化点集：side x side整数格点上随机取点（大量共线、共圆与重合）
+NodeSet latticeNodes(int n, int side, SeededRandom& rng) {
+    NodeSet nodes;
+    nodes.reserve(n);
+    for (int i = 0; i < n; i++) {
+        nodes.add(rng.below(side), rng.below(side));
+    }
+    return nodes;
+}
+
+// 退化点集：圆上64个等分点中随机取点（共圆且含重合点）
+NodeSet cocircularNodes(int n, SeededRandom& rng) {
+    NodeSet nodes;
+    nodes.reserve(n);
+    for (int i = 0; i < n; i++) {
+        double angle = rng.below(64) * (6.283185307179586 / 64);
+        nodes.add(1000.0 * std::cos(angle), 1000.0 * std::sin(angle));
+    }
+    return nodes;
+}
+
+// 候选边模式的MST必须与完全图一致（边数相同，总权重在舍入误差内相同）
+bool verifyCandidateModes(const NodeSet& nodes, const char* name) {
+    DoubleGraph reference{NodeSet(nodes)};
+    NodesToEdges(reference, EdgeBuildMode::Complete);
+    reference.kruskalMST();
+
+    bool ok = true;
+    const EdgeBuildMode modes[] = { EdgeBuildMode::Delaunay, EdgeBuildMode::KNearest, EdgeBuildMode::SpatialGrid };
+    for (EdgeBuildMode mode : modes) {
+        DoubleGraph graph{NodeSet(nodes)};
+        NodesToEdges(graph, mode);
+        graph.kruskalMST();
+        double expected = reference.getMSTTotalWeight();
+        double actual = graph.getMSTTotalWeight();
+        if (graph.getMSTEdgeCount() != reference.getMSTEdgeCount()
+            || std::fabs(actual - expected) > 1e-9 * std::max(1.0, expected)) {
+            std::cerr << "错误：" << name << "（" << nodes.size() << " 个节点）" << modeName(mode)
+                << " 模式的MST为 " << actual << "（" << graph.getMSTEdgeCount() << " 条边），完全图为 "
+                << expected << "（" << reference.getMSTEdgeCount() << " 条边）" << std::endl;
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+int runVerify(uint64_t seed) {
+    SeededRandom rng(seed);
+    int checks = 0;
+    int failures = 0;
+    auto check = [&](const NodeSet& nodes, const char* name) {
+        checks++;
+        if (!verifyCandidateModes(nodes, name)) failures++;
+    };
+
+    for (int n = 2; n <= 12; n++) {
+        NodeSet nodes;
+        for (int i = 0; i < n; i++) nodes.add(0.1 * i, 0.3 * i + 1);
+        check(nodes, "inexact_collinear_distinct");
+    }
+    for (int t = 0; t < 200; t++) {
+        check(inexactCollinearNodes(50 + rng.below(151), 60, rng), "inexact_collinear_duplicates");
+    }
+    for (int t = 0; t < 50; t++) {
+        check(latticeNodes(3 + rng.below(300), 10, rng), "lattice");
+        check(cocircularNodes(3 + rng.below(200), rng), "cocircular");
+    }
+    check(inexactCollinearNodes(3000, 1500, rng), "inexact_collinear_duplicates");
+
+    std::cout << "verify: " << checks << " 个点集，" << failures << " 个不一致" << std::endl;
+    return failures == 0 ? 0 : 2;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::cerr << "用法: " << argv[0]
+            << " [--sizes 1000,10000,...] [--complete-max N] [--repeat N] [--seed N] [--out FILE] [--verify]"
+            << std::endl;
+        return 1;
+    }
+
+    // 计时期间关闭日志，避免控制台I/O干扰测量
+    Logger::setLevel(Logger::Off);
+
+    if (options.verify) {
+        return runVerify(options.seed);
+    }
+
+    std::ofstream outFile;
+    if (!options.outPath.empty()) {
+        outFile.open(options.outPath);
+        if (!outFile) {
+            std::cerr << "错误：无法打开输出文件 " << options.outPath << std::endl;
+            return 1;
+        }
+    }
+    Reporter reporter(options.outPath.empty() ? std::cout : outFile, options.seed);
+
+    const Distribution dists[] = { Distribution::Uniform, Distribution::Clustered, Distribution::Collinear };
+    for (int n : options.sizes) {
+        for (Distribution dist : dists) {
+            PointSet points = generatePoints(dist, n, options.seed + static_cast<uint64_t>(n));
+            NodeSet nodes = makeNodeSet(points);
+
+            std::vector<EdgeBuildMode> modes{ EdgeBuildMode::Delaunay, EdgeBuildMode::KNearest,
+                                            EdgeBuildMode::Manhattan, EdgeBuildMode::SpatialGrid };
+            if (n <= options.completeMax) modes.push_back(EdgeBuildMode::Complete);
+
+            for (EdgeBuildMode mode : modes) {
+                report(reporter, benchNodesToEdges(nodes, dist, mode, options.repeat));
+
+                Graph graph{NodeSet(nodes)};
+                NodesToEdges(graph, mode);
+
+                report(reporter, benchHeapSort(graph, dist, mode, options.repeat));
+                report(reporter, benchKruskal(graph, dist, mode, options.repeat));
+                report(reporter, benchFileIO(points, dist, mode, options.seed, options.repeat));
+            }
+        }
+        report(reporter, benchUnionFind(n, options.seed + static_cast<uint64_t>(n), options.repeat));
+    }
+    return 0;
+}
@@ -4,10 +4,15 @@
  */
 
 #include "GraphFileIO.h"
+#include "Logger.h"
+#include "NodeSet.h"
 #include <cctype>
 #include <cstdlib>
 #include <cerrno>
 #include <stdexcept>
+#include <algorithm>
+#include <climits>
+#include <utility>
 
  // �����ַ�������
 int GraphFileIO::stringLength(const char* str) {
@@ -188,7 +193,7 @@ int GraphFileIO::readCoordinates(FILE* file, int vertexCount, double* xCoords, d
 
     for (int i = 0; i < vertexCount; i++) {
         if (std::fgets(line, MAX_LINE_LENGTH, file) == nullptr) {
-            std::fprintf(stderr, "�����ļ�������������� %d �����꣬��ֻ������ %d ��\n", vertexCount, i);
+            std::fprintf(stderr, "�����ļ�������������� %d �����꣬��ֻ������ %d �� (%s)\n", vertexCount, i, filename);
             return -1;
         }
 
@@ -200,7 +205,6 @@ int GraphFileIO::readCoordinates(FILE* file, int vertexCount, double* xCoords, d
         // ��������������
         char* token = line;
         int coordIndex = 0;
-        bool success = true;
 
         while (*token != '\0' && coordIndex < 2) {
             // �����հ�
@@ -240,7 +244,7 @@ int GraphFileIO::readCoordinates(FILE* file, int vertexCount, double* xCoords, d
             coordinatesRead++;
         }
         else {
-            std::fprintf(stderr, "���棺�� %d �������ʽ��Ч: %s\n", i + 2, line);
+            std::fprintf(stderr, "���棺�� %d �������ʽ��Ч: %s (%s)\n", i + 2, line, filename);
         }
     }
 
@@ -248,20 +252,22 @@ int GraphFileIO::readCoordinates(FILE* file, int vertexCount, double* xCoords, d
 }
 
 // �����ܣ���ȡ�ڵ㲢����ͼ
-bool GraphFileIO::readNodesAndBuildGraph(Graph& graph, const char* filename) {
-    std::printf("��ʼ���ļ���ȡ�ڵ�����: %s\n", filename);
+template <typename W>
+bool GraphFileIO::readNodesAndBuildGraph(BasicGraph<W>& graph, const char* filename, EdgeBuildMode mode) {
+    LOGF_SUMMARY("��ʼ���ļ���ȡ�ڵ�����: %s\n", filename);
 
     // ���ļ�
-    FILE* file = nullptr;
-    errno_t err = fopen_s(&file, filename, "r");
-    if (err != 0 || file == nullptr) {
+    FILE* file = std::fopen(filename, "r");
+    if (file == nullptr) {
+        int err = errno;
         std::fprintf(stderr, "�����޷����ļ� %s��������: %d\n", filename, err);
         return false; // ���ʵ��Ĵ�����
     }
 
     // �������������ڴ�
-    double* xCoords = new double[MAX_NODES];
-    double* yCoords = new double[MAX_NODES];
+    // 按图的顶点数分配，避免每次都按MAX_NODES分配
+    double* xCoords = new double[graph.getVertices()];
+    double* yCoords = new double[graph.getVertices()];
 
     if (xCoords == nullptr || yCoords == nullptr) {
         std::fprintf(stderr, "�����ڴ����ʧ��\n");
@@ -282,16 +288,16 @@ bool GraphFileIO::readNodesAndBuildGraph(Graph& graph, const char* filename) {
             throw std::runtime_error("��Ч�Ķ�������");
         }
 
-        std::printf("�ļ�������������: %d\n", fileVertexCount);
+        LOGF_SUMMARY("�ļ�������������: %d\n", fileVertexCount);
 
         // 使用Graph对象的实际大小作为顶点数量，确保与MainWindow中创建的Graph对象一致
         vertexCount = graph.getVertices();
-        std::printf("实际使用的顶点数量: %d\n", vertexCount);
+        LOGF_SUMMARY("实际使用的顶点数量: %d\n", vertexCount);
 
         // 检查文件中的顶点数量是否与Graph对象的大小一致
         if (fileVertexCount != vertexCount) {
-            char buffer[100];
-            sprintf_s(buffer, sizeof(buffer), "警告: 文件中的顶点数量(%d)与预期数量(%d)不一致，将使用预期数量",
+            char buffer[256];
+            std::snprintf(buffer, sizeof(buffer), "警告: 文件中的顶点数量(%d)与预期数量(%d)不一致，将使用预期数量",
                 fileVertexCount, vertexCount);
             std::fprintf(stderr, "%s\n", buffer);
         }
@@ -303,35 +309,53 @@ bool GraphFileIO::readNodesAndBuildGraph(Graph& graph, const char* filename) {
             vertexCount = coordinatesRead;  // ʹ��ʵ�ʶ�ȡ������
         }
 
-        std::printf("�ɹ���ȡ %d ���ڵ������\n", vertexCount);
+        LOGF_SUMMARY("�ɹ���ȡ %d ���ڵ������\n", vertexCount);
 
-        // Ϊÿ�Խڵ㴴����
-        int edgesAdded = 0;
-        int skippedCount = 0;
+        // 文件读入的距离按四舍五入转换为整数权重
+        graph.setRoundDistances(true);
 
+        // 文件特有的校验：坐标须为有限值（无效坐标在建边时跳过）；
+        // 候选边方式（Delaunay、k近邻等）按整体坐标范围计算，范围的对角线溢出时无法建边，拒绝该文件。
+        // Complete方式逐边计算距离，溢出的边单独跳过，远离其他节点的坐标不影响其余边
+        int skippedCount = 0;
+        double minX = 0.0, minY = 0.0, maxX = 0.0, maxY = 0.0;
+        bool anyValid = false;
         for (int i = 0; i < vertexCount; i++) {
-            // 保存节点坐标到Graph对象
-            graph.setNodeCoordinates(i, xCoords[i], yCoords[i]);
-            
-            for (int j = i + 1; j < vertexCount; j++) {
-                double distance = calculateDistance(xCoords[i], yCoords[i], xCoords[j], yCoords[j]);
-
-                if (distance < 0 || std::isnan(distance) || std::isinf(distance)) {
-                    std::fprintf(stderr, "���棺�ڵ� %d �� %d �ľ��������Ч: %.2f������\n", i, j, distance);
-                    skippedCount++;
-                    continue;
-                }
-
-                // ��������Ϊ����Ȩ��
-                int weight = static_cast<int>(distance + 0.5);
+            if (!std::isfinite(xCoords[i]) || !std::isfinite(yCoords[i])) {
+                skippedCount++;
+                continue;
+            }
+            if (!anyValid) {
+                minX = maxX = xCoords[i];
+                minY = maxY = yCoords[i];
+                anyValid = true;
+            }
+            minX = std::min(minX, xCoords[i]);
+            maxX = std::max(maxX, xCoords[i]);
+            minY = std::min(minY, yCoords[i]);
+            maxY = std::max(maxY, yCoords[i]);
+        }
+        if (mode != EdgeBuildMode::Complete && !std::isfinite(calculateDistance(minX, minY, maxX, maxY))) {
+            throw std::runtime_error("坐标范围过大，节点间距离溢出");
+        }
 
-                // ���ӱߵ�ͼ��
-                graph.addEdge(i, j, weight);
-                edgesAdded++;
+        // 坐标交由图接管，建边方式的分派与NodesToEdges共用；
+        // 文件中缺少坐标的顶点记为NaN，与无效坐标一样在建边时跳过
+        NodeSet nodes(graph.getVertices());
+        for (int i = 0; i < graph.getVertices(); i++) {
+            if (i < vertexCount) {
+                nodes.set(i, xCoords[i], yCoords[i]);
+            }
+            else {
+                nodes.set(i, std::nan(""), std::nan(""));
+                skippedCount++;
             }
         }
+        graph.setNodes(std::move(nodes));
+        NodesToEdges(graph, mode);
+        int edgesAdded = graph.getEdgeCount();
 
-        std::printf("ͼ������ɡ��ɹ����� %d ���ߣ����� %d ����Ч��\n", edgesAdded, skippedCount);
+        LOGF_SUMMARY("ͼ������ɡ��ɹ����� %d ���ߣ����� %d ����Ч��\n", edgesAdded, skippedCount);
         success = true;
 
     }
@@ -348,11 +372,17 @@ bool GraphFileIO::readNodesAndBuildGraph(Graph& graph, const char* filename) {
     return success;
 }
 
+// 显式实例化：四种边权类型
+template bool GraphFileIO::readNodesAndBuildGraph<int>(BasicGraph<int>&, const char*, EdgeBuildMode);
+template bool GraphFileIO::readNodesAndBuildGraph<long long>(BasicGraph<long long>&, const char*, EdgeBuildMode);
+template bool GraphFileIO::readNodesAndBuildGraph<float>(BasicGraph<float>&, const char*, EdgeBuildMode);
+template bool GraphFileIO::readNodesAndBuildGraph<double>(BasicGraph<double>&, const char*, EdgeBuildMode);
+
 // ���ļ��ȡ��������
 int GraphFileIO::readVertexCountOnly(const char* filename) {
-    FILE* file = nullptr;
-    errno_t err = fopen_s(&file, filename, "r");
-    if (err != 0 || file == nullptr) {
+    FILE* file = std::fopen(filename, "r");
+    if (file == nullptr) {
+        int err = errno;
         std::fprintf(stderr, "�����޷����ļ� %s��������: %d\n", filename, err);
         return -1;
     }
@@ -373,11 +403,11 @@ int GraphFileIO::readVertexCountOnly(const char* filename) {
 
 // �ļ���֤
 bool GraphFileIO::validateFile(const char* filename) {
-    std::printf("��֤�ļ���ʽ: %s\n", filename);
+    LOGF_SUMMARY("��֤�ļ���ʽ: %s\n", filename);
 
-    FILE* file = nullptr;
-    errno_t err = fopen_s(&file, filename, "r");
-    if (err != 0 || file == nullptr) {
+    FILE* file = std::fopen(filename, "r");
+    if (file == nullptr) {
+        int err = errno;
         std::fprintf(stderr, "�����޷����ļ� %s��������: %d\n", filename, err);
         return false; // ���ʵ��Ĵ�����
     }
@@ -404,7 +434,7 @@ bool GraphFileIO::validateFile(const char* filename) {
             throw std::runtime_error("�����ȡ����������Ԥ��");
         }
 
-        std::printf("�ļ���ʽ��֤ͨ������������: %d\n", vertexCount);
+        LOGF_SUMMARY("�ļ���ʽ��֤ͨ������������: %d\n", vertexCount);
         isValid = true;
 
     }
@@ -15,7 +15,7 @@
 
 class GraphFileIO {
 private:
-    static const int MAX_NODES = 1000;  // ���ڵ���
+    static const int MAX_NODES = 1000000;  // ���ڵ���
     static const int MAX_LINE_LENGTH = 256;  // ����г���
 
 public:
@@ -23,9 +23,14 @@ public:
      * @brief ���ļ���ȡ�ڵ����겢��䵽ͼ����
      * @param graph Ҫ����ͼ��������
      * @param filename �����ڵ�������ļ�·��
+     * @param mode 边生成方式：Complete为完全图，Delaunay仅生成三角剖分候选边，KNearest仅生成k近邻候选边，
+     *             Manhattan按L1距离仅生成扇区候选边，SpatialGrid仅生成网格近邻候选边
+     * @note 对int、long long、float、double四种边权类型显式实例化
      * @return bool �ɹ�����true��ʧ�ܷ���false
      */
-    static bool readNodesAndBuildGraph(Graph& graph, const char* filename);
+    template <typename W>
+    static bool readNodesAndBuildGraph(BasicGraph<W>& graph, const char* filename,
+                                       EdgeBuildMode mode = EdgeBuildMode::Complete);
 
     /**
      * @brief ��֤�ļ���ʽ�Ƿ���Ч
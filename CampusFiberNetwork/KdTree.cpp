@@ -0,0 +1,352 @@
+/**
+ * @file KdTree.cpp
+ * @brief kd树与k近邻候选边生成实现文件
+ */
+
+#include "KdTree.h"
+#include "UnionFind.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+const int EMPTY_RANGE = -2; // annotate中表示空区间
+
+// 合并两个子树标签：空区间不影响结果，标签不同则为-1（混合）
+int mergeLabel(int a, int b) {
+    if (a == EMPTY_RANGE) return b;
+    if (b == EMPTY_RANGE) return a;
+    return a == b ? a : -1;
+}
+
+// 候选边的全序：(距离平方, 较小端点, 较大端点)，保证Borůvka各分量的选择一致、不成环
+struct CandidateEdge {
+    double dist2;
+    int u;
+    int v;
+};
+
+bool candidateLess(double d2a, int ua, int va, const CandidateEdge& b) {
+    if (d2a != b.dist2) return d2a < b.dist2;
+    int loA = std::min(ua, va), hiA = std::max(ua, va);
+    int loB = std::min(b.u, b.v), hiB = std::max(b.u, b.v);
+    if (loA != loB) return loA < loB;
+    return hiA < hiB;
+}
+
+} // namespace
+
+KdTree::KdTree(const double* xs, const double* ys, int n)
+    : xs(xs), ys(ys), count(n), perm(n), splitDim(n, 0), nodeLabel(n, -1) {
+    for (int i = 0; i < n; i++) {
+        perm[i] = i;
+    }
+    build(0, n);
+}
+
+/**
+ * @brief 递归建树：选择坐标跨度较大的维度，以中位数为划分点
+ * @note 同坐标按点下标排序，使树结构只取决于输入
+ */
+void KdTree::build(int lo, int hi) {
+    if (hi - lo <= LEAF_SIZE) {
+        return;
+    }
+
+    double minX = xs[perm[lo]], maxX = minX;
+    double minY = ys[perm[lo]], maxY = minY;
+    for (int i = lo + 1; i < hi; i++) {
+        int p = perm[i];
+        minX = std::min(minX, xs[p]);
+        maxX = std::max(maxX, xs[p]);
+        minY = std::min(minY, ys[p]);
+        maxY = std::max(maxY, ys[p]);
+    }
+    int dim = (maxX - minX >= maxY - minY) ? 0 : 1;
+
+    int mid = lo + (hi - lo) / 2;
+    std::nth_element(perm.begin() + lo, perm.begin() + mid, perm.begin() + hi,
+        [this, dim](int a, int b) {
+            double ca = coord(a, dim);
+            double cb = coord(b, dim);
+            return ca < cb || (ca == cb && a < b);
+        });
+    splitDim[mid] = static_cast<char>(dim);
+
+    build(lo, mid);
+    build(mid + 1, hi);
+}
+
+void KdTree::searchKNearest(int lo, int hi, int query, int k,
+                            std::vector<std::pair<double, int>>& heap) const {
+    auto consider = [&](int p) {
+        if (p == query) return;
+        std::pair<double, int> candidate(distance2(query, p), p);
+        if (static_cast<int>(heap.size()) < k) {
+            heap.push_back(candidate);
+            std::push_heap(heap.begin(), heap.end());
+        }
+        else if (candidate < heap.front()) {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = candidate;
+            std::push_heap(heap.begin(), heap.end());
+        }
+    };
+
+    if (hi - lo <= LEAF_SIZE) {
+        for (int i = lo; i < hi; i++) {
+            consider(perm[i]);
+        }
+        return;
+    }
+
+    int mid = lo + (hi - lo) / 2;
+    int pivot = perm[mid];
+    int dim = splitDim[mid];
+    consider(pivot);
+
+    double diff = coord(query, dim) - coord(pivot, dim);
+    if (diff < 0) {
+        searchKNearest(lo, mid, query, k, heap);
+        // 距离相同的点也需访问，保证同距离时按下标取舍
+        if (static_cast<int>(heap.size()) < k || diff * diff <= heap.front().first) {
+            searchKNearest(mid + 1, hi, query, k, heap);
+        }
+    }
+    else {
+        searchKNearest(mid + 1, hi, query, k, heap);
+        if (static_cast<int>(heap.size()) < k || diff * diff <= heap.front().first) {
+            searchKNearest(lo, mid, query, k, heap);
+        }
+    }
+}
+
+void KdTree::kNearest(int query, int k, std::vector<std::pair<double, int>>& result) const {
+    result.clear();
+    if (k <= 0 || count <= 1) {
+        return;
+    }
+    searchKNearest(0, count, query, k, result);
+    std::sort_heap(result.begin(), result.end());
+}
+
+int KdTree::annotate(int lo, int hi, const int* labels) {
+    if (lo >= hi) {
+        return EMPTY_RANGE;
+    }
+
+    if (hi - lo <= LEAF_SIZE) {
+        int label = EMPTY_RANGE;
+        for (int i = lo; i < hi; i++) {
+            label = mergeLabel(label, labels[perm[i]]);
+        }
+        // 叶子区间不含任何划分点，以区间起点作为其标签下标不会与内部节点冲突
+        nodeLabel[lo] = label;
+        return label;
+    }
+
+    int mid = lo + (hi - lo) / 2;
+    int label = mergeLabel(annotate(lo, mid, labels), annotate(mid + 1, hi, labels));
+    label = mergeLabel(label, labels[perm[mid]]);
+    nodeLabel[mid] = label;
+    return label;
+}
+
+void KdTree::annotateLabels(const int* labels) {
+    annotate(0, count, labels);
+}
+
+void KdTree::searchForeign(int lo, int hi, int query, const int* labels, int excludeLabel,
+                           double& bestDist2, int& best) const {
+    if (lo >= hi) {
+        return;
+    }
+
+    auto consider = [&](int p) {
+        if (labels[p] == excludeLabel) return;
+        double d2 = distance2(query, p);
+        if (d2 < bestDist2 || (d2 == bestDist2 && (best < 0 || p < best))) {
+            bestDist2 = d2;
+            best = p;
+        }
+    };
+
+    if (hi - lo <= LEAF_SIZE) {
+        // 整个子树都属于查询点所在分量时直接跳过
+        if (nodeLabel[lo] == excludeLabel) return;
+        for (int i = lo; i < hi; i++) {
+            consider(perm[i]);
+        }
+        return;
+    }
+
+    int mid = lo + (hi - lo) / 2;
+    if (nodeLabel[mid] == excludeLabel) return;
+
+    int pivot = perm[mid];
+    int dim = splitDim[mid];
+    consider(pivot);
+
+    double diff = coord(query, dim) - coord(pivot, dim);
+    if (diff < 0) {
+        searchForeign(lo, mid, query, labels, excludeLabel, bestDist2, best);
+        if (diff * diff <= bestDist2) {
+            searchForeign(mid + 1, hi, query, labels, excludeLabel, bestDist2, best);
+        }
+    }
+    else {
+        searchForeign(mid + 1, hi, query, labels, excludeLabel, bestDist2, best);
+        if (diff * diff <= bestDist2) {
+            searchForeign(lo, mid, query, labels, excludeLabel, bestDist2, best);
+        }
+    }
+}
+
+int KdTree::nearestForeign(int query, const int* labels, double& bestDist2) const {
+    int best = -1;
+    searchForeign(0, count, query, labels, labels[query], bestDist2, best);
+    return best;
+}
+
+/**
+ * @brief k近邻候选边 + Borůvka补边
+ *
+ * 每轮为每个连通分量求最短出边（按CandidateEdge全序）：
+ * 点i的最近异分量点要么是其近邻表中第一个不在本分量的点，
+ * 要么在近邻表之外（距离不小于第k近邻），此时才做kd树查询。
+ * 分量只会合并，近邻表中已同分量的点以后也始终同分量，因此近邻表指针单调前进。
+ * 每轮选出的边都属于欧氏最小生成树，全部加入候选边后候选集必含一棵欧氏最小生成树。
+ * 近邻表的成员检查代替排序去重，整体为O(n log n + nk^2)。
+ */
+int KdTree::candidateEdges(const double* xs, const double* ys, int n, int k,
+                           std::vector<std::pair<int, int>>& edges) {
+    edges.clear();
+    if (n < 2) {
+        return 0;
+    }
+    k = std::max(1, std::min(k, n - 1));
+
+    KdTree tree(xs, ys, n);
+
+    // 各点的k近邻表（按距离升序），以连续数组存放
+    std::vector<int> neighbors(static_cast<size_t>(n) * k);
+    std::vector<double> neighborDist2(static_cast<size_t>(n) * k);
+    std::vector<std::pair<double, int>> result;
+    // 按树序查询：相邻查询访问的树节点相近，缓存命中率更高
+    for (int t = 0; t < n; t++) {
+        int i = tree.perm[t];
+        tree.kNearest(i, k, result);
+        size_t base = static_cast<size_t>(i) * k;
+        for (int j = 0; j < k; j++) {
+            neighbors[base + j] = result[j].second;
+            neighborDist2[base + j] = result[j].first;
+        }
+    }
+
+    // 点v是否在点u的近邻表中
+    auto listed = [&](int u, int v) {
+        const int* list = &neighbors[static_cast<size_t>(u) * k];
+        return std::find(list, list + k, v) != list + k;
+    };
+
+    // 互为近邻的点对只由较小下标一侧输出一次，避免排序去重
+    edges.reserve(static_cast<size_t>(n) * k);
+    for (int i = 0; i < n; i++) {
+        size_t base = static_cast<size_t>(i) * k;
+        for (int j = 0; j < k; j++) {
+            int v = neighbors[base + j];
+            if (i < v || !listed(v, i)) {
+                edges.emplace_back(std::min(i, v), std::max(i, v));
+            }
+        }
+    }
+
+    // Borůvka：最近异分量查询补边，直到全部连通
+    const double INF_DIST = std::numeric_limits<double>::infinity();
+    UnionFind uf(n);
+    int components = n;
+    std::vector<int> labels(n);
+    std::vector<int> cursor(n, 0);
+    std::vector<CandidateEdge> best(n);
+    // 各点到最近异分量点距离平方的下界：分量只会合并，异分量点只减不增，下界跨轮有效
+    std::vector<double> foreignBound(n);
+    for (int i = 0; i < n; i++) {
+        foreignBound[i] = neighborDist2[static_cast<size_t>(i) * k + k - 1];
+    }
+    std::vector<int> exhausted;
+
+    while (components > 1) {
+        for (int i = 0; i < n; i++) {
+            labels[i] = uf.find(i);
+            best[i] = { INF_DIST, -1, -1 };
+        }
+
+        auto offer = [&](int component, double d2, int u, int v) {
+            if (best[component].u < 0 || candidateLess(d2, u, v, best[component])) {
+                best[component] = { d2, u, v };
+            }
+        };
+
+        exhausted.clear();
+        for (int i = 0; i < n; i++) {
+            int c = labels[i];
+            size_t base = static_cast<size_t>(i) * k;
+            while (cursor[i] < k && labels[neighbors[base + cursor[i]]] == c) {
+                cursor[i]++;
+            }
+            if (cursor[i] < k) {
+                offer(c, neighborDist2[base + cursor[i]], i, neighbors[base + cursor[i]]);
+            }
+            else {
+                exhausted.push_back(i);
+            }
+        }
+
+        // 近邻表已耗尽的点：只在其下界不劣于本分量当前最短出边时查询kd树
+        if (!exhausted.empty()) {
+            // 按下界升序处理，先查询的点给出较紧的分量上界，后续点多可直接跳过
+            std::sort(exhausted.begin(), exhausted.end(), [&](int a, int b) {
+                return foreignBound[a] < foreignBound[b] || (foreignBound[a] == foreignBound[b] && a < b);
+            });
+            bool annotated = false;
+            for (int i : exhausted) {
+                int c = labels[i];
+                if (best[c].u >= 0 && foreignBound[i] > best[c].dist2) {
+                    continue;
+                }
+                if (!annotated) {
+                    tree.annotateLabels(labels.data());
+                    annotated = true;
+                }
+                double d2 = best[c].u >= 0 ? best[c].dist2 : INF_DIST;
+                int v = tree.nearestForeign(i, labels.data(), d2);
+                // 找到时d2为精确距离；未找到时说明最近异分量点远于搜索半径d2
+                foreignBound[i] = std::max(foreignBound[i], d2);
+                if (v >= 0) {
+                    offer(c, d2, i, v);
+                }
+            }
+        }
+
+        int merged = 0;
+        for (int c = 0; c < n; c++) {
+            if (labels[c] != c || best[c].u < 0) continue;
+            int u = best[c].u;
+            int v = best[c].v;
+            if (uf.find(u) != uf.find(v)) {
+                uf.unite(u, v);
+                // 沿近邻表找到的边已输出过，只补充kd树查询得到的新边
+                if (!listed(u, v) && !listed(v, u)) {
+                    edges.emplace_back(std::min(u, v), std::max(u, v));
+                }
+                components--;
+                merged++;
+            }
+        }
+        if (merged == 0) {
+            break;
+        }
+    }
+
+    return static_cast<int>(edges.size());
+}
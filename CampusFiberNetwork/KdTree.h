@@ -0,0 +1,88 @@
+/**
+ * @file KdTree.h
+ * @brief 平面点集的kd树，用于k近邻候选边与最近异分量查询
+ * @class KdTree
+ * @brief 隐式平衡kd树：按坐标跨度较大的维度取中位数划分，节点存放于下标排列中
+ *
+ * 完全图需要O(V^2)条边，而k近邻图只有O(kV)条边。k近邻图本身可能不连通，
+ * 且其最小生成树不一定是欧氏最小生成树，因此 candidateEdges 在k近邻边之外，
+ * 再用Borůvka式的最近异分量查询补充边，保证候选边集包含一棵欧氏最小生成树。
+ */
+
+#ifndef KD_TREE_H
+#define KD_TREE_H
+
+#include <utility>
+#include <vector>
+
+class KdTree {
+private:
+    static const int LEAF_SIZE = 8; // 叶子区间的最大点数
+
+    const double* xs;             // 点的X坐标（不拷贝，调用方保证生命周期）
+    const double* ys;             // 点的Y坐标
+    int count;                    // 点数
+    std::vector<int> perm;        // 树序排列：区间[lo,hi)的中点为划分点，左右子区间为子树
+    std::vector<char> splitDim;   // 以划分点位置为下标的划分维度（0为X，1为Y）
+    std::vector<int> nodeLabel;   // 子树内标签一致时为该标签，否则为-1（见annotateLabels）
+
+    void build(int lo, int hi);
+    int annotate(int lo, int hi, const int* labels);
+
+    double coord(int point, int dim) const { return dim == 0 ? xs[point] : ys[point]; }
+    double distance2(int a, int b) const {
+        double dx = xs[a] - xs[b];
+        double dy = ys[a] - ys[b];
+        return dx * dx + dy * dy;
+    }
+
+    // 最大堆（按(距离平方, 下标)）形式的k近邻搜索
+    void searchKNearest(int lo, int hi, int query, int k,
+                        std::vector<std::pair<double, int>>& heap) const;
+    void searchForeign(int lo, int hi, int query, const int* labels, int excludeLabel,
+                       double& bestDist2, int& best) const;
+
+public:
+    /**
+     * @brief 在给定坐标上建树，O(n log n)
+     * @note 坐标数组在KdTree使用期间必须保持有效且不被修改
+     */
+    KdTree(const double* xs, const double* ys, int n);
+
+    /**
+     * @brief 查询点query的k个最近邻（不含自身）
+     * @param result 输出：(距离平方, 点下标)，按距离升序、同距离按下标升序
+     */
+    void kNearest(int query, int k, std::vector<std::pair<double, int>>& result) const;
+
+    /**
+     * @brief 记录每棵子树的标签是否一致，供 nearestForeign 整棵剪枝
+     * @param labels 每个点的标签（非负）
+     */
+    void annotateLabels(const int* labels);
+
+    /**
+     * @brief 查询与query标签不同的最近点
+     * @param bestDist2 输入：搜索半径平方上界（只返回不超过该值的点）；输出：找到的距离平方
+     * @return 点下标，范围内不存在时返回-1
+     * @note 调用前须以同一labels调用过 annotateLabels；同距离时返回下标较小者
+     */
+    int nearestForeign(int query, const int* labels, double& bestDist2) const;
+
+    /**
+     * @brief 生成包含欧氏最小生成树的k近邻候选边
+     * @param xs 点的X坐标数组
+     * @param ys 点的Y坐标数组
+     * @param n 点的数量
+     * @param k 每个点的近邻数（自动截断到n-1）
+     * @param edges 输出：无重复的边（顶点下标对，first < second）
+     * @return 输出的边数
+     * @note 先取各点的k近邻边，再以Borůvka方式逐轮为每个连通分量找最短出边：
+     *       优先沿各点的近邻表查找，近邻表全部落在本分量内时才回退到kd树查询。
+     *       边数为O(kV)，内存O(kV)
+     */
+    static int candidateEdges(const double* xs, const double* ys, int n, int k,
+                              std::vector<std::pair<int, int>>& edges);
+};
+
+#endif // KD_TREE_H
@@ -0,0 +1,70 @@
+/**
+ * @file Logger.h
+ * @brief 分级日志：编译期级别 + 运行期级别
+ * @class Logger
+ * @brief 控制Graph、GraphFileIO、NodesToEdges等模块的控制台输出
+ *
+ * 级别：Off（不输出）、Summary（每次建图/求解的概要）、Trace（逐边明细）。
+ * 编译期级别由宏 CFN_LOG_LEVEL 指定（CMake 选项 CFN_LOG_LEVEL），
+ * 未指定时Debug构建为Trace、Release构建（定义NDEBUG）为Off，需要概要输出的发布构建可指定为1。
+ * 高于编译期级别的日志语句条件恒为假，整条语句（包括其中的循环）被编译器完全消除；
+ * 运行期可通过 Logger::setLevel 进一步降低输出级别，默认为Summary。
+ * 运行期级别是头文件中的内联原子变量，判断只是一次relaxed读取，不经过函数调用。
+ * 错误与警告仍直接输出到标准错误，不受日志级别控制。
+ */
+
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <cstdio>
+#include <iostream>
+
+#define LOG_LEVEL_OFF 0
+#define LOG_LEVEL_SUMMARY 1
+#define LOG_LEVEL_TRACE 2
+
+#ifndef CFN_LOG_LEVEL
+#ifdef NDEBUG
+#define CFN_LOG_LEVEL LOG_LEVEL_OFF
+#else
+#define CFN_LOG_LEVEL LOG_LEVEL_TRACE
+#endif
+#endif
+
+class Logger {
+public:
+    enum Level {
+        Off = LOG_LEVEL_OFF,
+        Summary = LOG_LEVEL_SUMMARY,
+        Trace = LOG_LEVEL_TRACE
+    };
+
+    // 设置运行期日志级别（线程安全）
+    static void setLevel(Level level) { runtimeLevel.store(static_cast<int>(level), std::memory_order_relaxed); }
+    // 获取运行期日志级别
+    static Level getLevel() { return static_cast<Level>(runtimeLevel.load(std::memory_order_relaxed)); }
+    // 运行期是否输出该级别
+    static bool isEnabled(int level) { return level <= runtimeLevel.load(std::memory_order_relaxed); }
+
+private:
+    // 运行期日志级别，默认只输出概要
+    static inline std::atomic<int> runtimeLevel{Summary};
+};
+
+// 编译期与运行期均启用时为真；编译期关闭时为常量false
+#define LOG_IS_ENABLED(level) (CFN_LOG_LEVEL >= (level) && Logger::isEnabled(level))
+
+// 流式日志：LOG_SUMMARY("边数: " << n);  自动换行
+#define LOG_SUMMARY(message) \
+    do { if (LOG_IS_ENABLED(LOG_LEVEL_SUMMARY)) { std::cout << message << '\n'; } } while (0)
+#define LOG_TRACE(message) \
+    do { if (LOG_IS_ENABLED(LOG_LEVEL_TRACE)) { std::cout << message << '\n'; } } while (0)
+
+// printf风格日志：LOGF_SUMMARY("边数: %d\n", n);
+#define LOGF_SUMMARY(...) \
+    do { if (LOG_IS_ENABLED(LOG_LEVEL_SUMMARY)) { std::printf(__VA_ARGS__); } } while (0)
+#define LOGF_TRACE(...) \
+    do { if (LOG_IS_ENABLED(LOG_LEVEL_TRACE)) { std::printf(__VA_ARGS__); } } while (0)
+
+#endif // LOGGER_H
@@ -2,7 +2,7 @@
 #include "ui_MainWindow.h"
 #include "GraphFileIO.h"
 #include "ManualInputDialog.h"
-#include "Node.h"
+#include "NodeSet.h"
 #include <QFileDialog>
 #include <QInputDialog>
 #include <QMessageBox>
@@ -14,6 +14,7 @@
 #include <QPen>
 #include <QColor>
 #include <cmath>
+#include <utility>
 #include <QWheelEvent>
 #include <QMouseEvent>
 
@@ -24,6 +25,7 @@ MainWindow::MainWindow(QWidget *parent)
     , currentGraph(nullptr)
     , isAlgorithmExecuted(false)
     , currentScale(1.0)
+    , graphFromUserNodes(false)
 {
     ui->setupUi(this);
     
@@ -53,20 +55,15 @@ void MainWindow::on_randomGenerateBtn_clicked()
     // 获取参数
     int numNodes = ui->nodesSpinBox->value();
     
-    // 创建图
-    if (currentGraph) {
-        delete currentGraph;
-    }
-    currentGraph = new Graph(numNodes);
-    
     // 清空用户节点列表
     userNodes.clear();
     
     // 生成随机坐标的节点
     QRandomGenerator *generator = QRandomGenerator::global();
     
-    // 创建Node数组
-    Node** nodes = new Node*[numNodes];
+    // 节点坐标连续存放，建图时由Graph移动接管
+    NodeSet nodes;
+    nodes.reserve(numNodes);
     nodePositions.clear();
     
     // 设置场景中心为坐标原点
@@ -81,10 +78,10 @@ void MainWindow::on_randomGenerateBtn_clicked()
         int y = generator->bounded(-500, 501);
         
         // 添加到用户节点列表
-        userNodes.append(QPointF(x, y));
+        userNodes.add(x, y);
         
-        // 创建Node对象
-        nodes[i] = new Node(x, y);
+        // 记录节点坐标
+        nodes.add(x, y);
         
         // 计算节点在场景中的位置（转换为Qt坐标系）
         qreal sceneX = centerX + x;
@@ -94,14 +91,13 @@ void MainWindow::on_randomGenerateBtn_clicked()
         nodePositions[i] = QPointF(sceneX, sceneY);
     }
     
-    // 根据节点坐标自动生成边（使用欧氏距离作为权重）
-    NodesToEdges(*currentGraph, nodes, numNodes);
-    
-    // 释放Node数组
-    for (int i = 0; i < numNodes; ++i) {
-        delete nodes[i];
+    // 创建图，并根据节点坐标自动生成边（使用欧氏距离作为权重）
+    if (currentGraph) {
+        delete currentGraph;
     }
-    delete[] nodes;
+    currentGraph = new Graph(std::move(nodes));
+    graphFromUserNodes = true;
+    NodesToEdges(*currentGraph);
     
     // 绘制图
     drawGraph();
@@ -142,6 +138,10 @@ void MainWindow::on_fileInputBtn_clicked()
     }
     currentGraph = graph;
     
+    // 导入的图与点击添加的节点无关，之后的点击重新开始
+    userNodes.clear();
+    graphFromUserNodes = false;
+    
     // 重置算法执行标志
     isAlgorithmExecuted = false;
     
@@ -173,15 +173,16 @@ void MainWindow::on_manualInputBtn_clicked()
         }
         currentGraph = graph;
         
-        // 获取节点坐标
-        QVector<Node> nodes = dialog.getNodes();
+        // 人工输入的图与点击添加的节点无关，之后的点击重新开始
+        userNodes.clear();
+        graphFromUserNodes = false;
         
-        // 设置节点位置
+        // 设置节点位置（节点坐标已由图接管）
         nodePositions.clear();
-        for (int i = 0; i < nodes.size(); ++i) {
+        for (int i = 0; i < currentGraph->getVertices(); ++i) {
             // 使用节点的实际坐标，但缩放以适应场景
-            float x = nodes[i].getX() * 0.5;
-            float y = nodes[i].getY() * 0.5;
+            qreal x = currentGraph->getNodeX(i) * 0.5;
+            qreal y = currentGraph->getNodeY(i) * 0.5;
             nodePositions.insert(i, QPointF(x, y));
         }
         
@@ -205,7 +206,7 @@ void MainWindow::on_runKruskalBtn_clicked()
         return;
     }
     
-    // 运行Kruskal算法
+    // 运行Kruskal算法（图自上次求解后未修改时直接复用缓存结果）
     currentGraph->kruskalMST();
     
     // 重新绘制图
@@ -443,16 +444,15 @@ void MainWindow::drawGraph()
     }
     
     // 绘制边
-    Edge** edges = currentGraph->getEdges();
+    const Edge* edges = currentGraph->getEdges();
     int edgeCount = currentGraph->getEdgeCount();
     
     for (int i = 0; i < edgeCount; ++i) {
-        Edge* edge = edges[i];
-        if (!edge) continue;
+        const Edge& edge = edges[i];
         
-        int src = edge->getSrc();
-        int dest = edge->getDest();
-        int weight = edge->getWeight();
+        int src = edge.getSrc();
+        int dest = edge.getDest();
+        int weight = edge.getWeight();
         
         QPointF srcPos = nodePositions[src];
         QPointF destPos = nodePositions[dest];
@@ -551,14 +551,13 @@ void MainWindow::generateNodePositions(int numNodes)
 void MainWindow::highlightMSTEdges()
 {
     // 高亮MST边
-    Edge** mstEdges = currentGraph->getMSTEdges();
+    const Edge* mstEdges = currentGraph->getMSTEdges();
     int mstEdgeCount = currentGraph->getMSTEdgeCount();
     
     for (int i = 0; i < mstEdgeCount; ++i) {
-        Edge* edge = mstEdges[i];
-        if (!edge) continue;
+        const Edge& edge = mstEdges[i];
         
-        QString key = QString("%1-%2").arg(edge->getSrc()).arg(edge->getDest());
+        QString key = QString("%1-%2").arg(edge.getSrc()).arg(edge.getDest());
         if (edges.contains(key)) {
             QGraphicsItem *item = edges[key];
             QGraphicsLineItem *line = dynamic_cast<QGraphicsLineItem*>(item);
@@ -621,6 +620,7 @@ void MainWindow::on_clearGraphBtn_clicked()
     
     // 清空用户节点列表
     userNodes.clear();
+    graphFromUserNodes = false;
     
     // 清空节点位置
     nodePositions.clear();
@@ -656,49 +656,62 @@ void MainWindow::mousePressEvent(QMouseEvent *event)
             qreal userX = scenePos.x() - centerX;
             qreal userY = centerY - scenePos.y(); // Qt坐标系Y轴向下，需要反转
             
+            // 视图变换异常时坐标可能为非有限值，不能加入图
+            if (!std::isfinite(userX) || !std::isfinite(userY)) {
+                QMessageBox::warning(this, "提示", "点击位置的坐标无效，未添加节点");
+                return;
+            }
+            
             // 限制节点坐标在坐标系范围内（X: -750到750，Y: -550到550）
             userX = qBound(-750.0, userX, 750.0);
             userY = qBound(-550.0, userY, 550.0);
             
             // 添加节点到用户节点列表
-            userNodes.append(QPointF(userX, userY));
-            
-            // 创建或更新图对象
-            if (currentGraph) {
-                delete currentGraph;
-            }
+            userNodes.add(userX, userY);
             
             int numNodes = userNodes.size();
-            currentGraph = new Graph(numNodes);
             
-            // 创建Node数组
-            Node** nodes = new Node*[numNodes];
-            nodePositions.clear();
+            // 计算新节点在场景中的位置（转换为Qt坐标系）
+            nodePositions[numNodes - 1] = QPointF(centerX + userX, centerY - userY);
             
-            // 设置场景中心为坐标原点
-            for (int i = 0; i < numNodes; ++i) {
-                // 创建Node对象
-                nodes[i] = new Node(userNodes[i].x(), userNodes[i].y());
+            if (currentGraph && graphFromUserNodes && currentGraph->getVertices() == numNodes - 1) {
+                // 图由此前的节点构建（随机生成或点击）：追加顶点，只连新节点的边并增量更新MST，O(V log V)
+                currentGraph->addVertex(userX, userY);
+                // MST此前已过期（如随机生成后）时addVertex不更新MST，在此重新求解；已增量更新时命中缓存
+                currentGraph->kruskalMST();
+            } else {
+                // 首个节点，或当前图来自文件导入/人工输入：用全部点击的节点重建
+                if (currentGraph) {
+                    delete currentGraph;
+                }
+                // 图接管节点坐标的副本（单个节点时也保存坐标，供后续addVertex计算距离）
+                currentGraph = new Graph(NodeSet(userNodes));
+                graphFromUserNodes = true;
                 
-                // 计算节点在场景中的位置（转换为Qt坐标系）
-                qreal sceneX = centerX + userNodes[i].x();
-                qreal sceneY = centerY - userNodes[i].y(); // Qt坐标系Y轴向下，需要反转
+                nodePositions.clear();
                 
-                // 存储节点位置
-                nodePositions[i] = QPointF(sceneX, sceneY);
-            }
-            
-            // 根据节点坐标自动生成边（使用欧氏距离作为权重）
-            NodesToEdges(*currentGraph, nodes, numNodes);
-            
-            // 释放Node数组
-            for (int i = 0; i < numNodes; ++i) {
-                delete nodes[i];
+                // 设置场景中心为坐标原点
+                for (int i = 0; i < numNodes; ++i) {
+                    // 计算节点在场景中的位置（转换为Qt坐标系）
+                    qreal sceneX = centerX + userNodes.getX(i);
+                    qreal sceneY = centerY - userNodes.getY(i); // Qt坐标系Y轴向下，需要反转
+                    
+                    // 存储节点位置
+                    nodePositions[i] = QPointF(sceneX, sceneY);
+                }
+                
+                // 根据节点坐标自动生成边（使用欧氏距离作为权重）
+                if (numNodes > 1) {
+                    NodesToEdges(*currentGraph);
+                }
+                
+                currentGraph->kruskalMST();
             }
-            delete[] nodes;
             
-            // 绘制图
+            // 绘制图，并高亮随节点实时更新的最小生成树
             drawGraph();
+            highlightMSTEdges();
+            ui->mstWeightLabel->setText(QString("最小生成树总权重: %1").arg(currentGraph->getMSTTotalWeight()));
             
             // 显示添加节点的消息
             QMessageBox::information(this, "成功", QString("已添加节点(%1, %2)，当前共有%3个节点").arg(userX, 0, 'f', 1).arg(userY, 0, 'f', 1).arg(numNodes));
@@ -64,7 +64,9 @@ private:
     // 当前缩放比例
     double currentScale;
     // 存储鼠标点击添加的节点坐标（相对于用户坐标系）
-    QVector<QPointF> userNodes;
+    NodeSet userNodes;
+    // 当前图是否由userNodes构建（随机生成或点击添加）；文件导入、人工输入的图为false
+    bool graphFromUserNodes;
 
     // 绘制图
     void drawGraph();
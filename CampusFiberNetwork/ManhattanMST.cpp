@@ -0,0 +1,121 @@
+/**
+ * @file ManhattanMST.cpp
+ * @brief 曼哈顿距离最小生成树候选边生成实现文件
+ */
+
+#include "ManhattanMST.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+/**
+ * @brief 后缀最小值树状数组：update向下更新，query向上查询
+ * @note query(pos)返回所有下标>=pos的位置中值最小的点
+ */
+class SuffixMinFenwick {
+private:
+    std::vector<double> minValue;
+    std::vector<int> minIndex;
+
+public:
+    explicit SuffixMinFenwick(int size)
+        : minValue(size + 1, std::numeric_limits<double>::infinity()), minIndex(size + 1, -1) {}
+
+    void update(int pos, double value, int index) {
+        for (int i = pos; i > 0; i -= i & -i) {
+            if (value < minValue[i]) {
+                minValue[i] = value;
+                minIndex[i] = index;
+            }
+        }
+    }
+
+    int query(int pos) const {
+        double best = std::numeric_limits<double>::infinity();
+        int bestIndex = -1;
+        for (int i = pos; i < static_cast<int>(minValue.size()); i += i & -i) {
+            if (minValue[i] < best) {
+                best = minValue[i];
+                bestIndex = minIndex[i];
+            }
+        }
+        return bestIndex;
+    }
+};
+
+} // namespace
+
+/**
+ * @brief 四个扇区各扫描一次
+ *
+ * 当前坐标系下，为每个点i求满足 x_j >= x_i 且 y_j - x_j >= y_i - x_i 的点中
+ * x_j + y_j 最小者，即该扇区内L1距离最近的点：
+ * 按(x, y)升序排序后从后往前扫描，已扫描的点都满足第一个条件；
+ * 以离散化后的 y - x 为下标存入后缀最小值树状数组，查询即得满足第二个条件的最近点。
+ * 依次交换x/y、取反x、再交换x/y，覆盖其余三个扇区。
+ */
+int ManhattanMST::candidateEdges(const double* xs, const double* ys, int n,
+                                 std::vector<std::pair<int, int>>& edges) {
+    edges.clear();
+    if (n < 2) {
+        return 0;
+    }
+
+    std::vector<double> px(xs, xs + n);
+    std::vector<double> py(ys, ys + n);
+    std::vector<int> order(n);
+    std::vector<double> keys(n);
+    // found[4*i + dir]：点i在第dir个扇区内的最近点，不存在时为-1
+    std::vector<int> found(4 * static_cast<size_t>(n), -1);
+
+    for (int dir = 0; dir < 4; dir++) {
+        if (dir == 1 || dir == 3) {
+            std::swap(px, py);
+        }
+        else if (dir == 2) {
+            for (int i = 0; i < n; i++) {
+                px[i] = -px[i];
+            }
+        }
+
+        for (int i = 0; i < n; i++) {
+            order[i] = i;
+            keys[i] = py[i] - px[i];
+        }
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            if (px[a] != px[b]) return px[a] < px[b];
+            if (py[a] != py[b]) return py[a] < py[b];
+            return a < b;
+        });
+
+        // 离散化 y - x
+        std::vector<double> sortedKeys(keys);
+        std::sort(sortedKeys.begin(), sortedKeys.end());
+        sortedKeys.erase(std::unique(sortedKeys.begin(), sortedKeys.end()), sortedKeys.end());
+
+        SuffixMinFenwick fenwick(static_cast<int>(sortedKeys.size()));
+        for (int t = n - 1; t >= 0; t--) {
+            int i = order[t];
+            int pos = static_cast<int>(std::lower_bound(sortedKeys.begin(), sortedKeys.end(), keys[i])
+                - sortedKeys.begin()) + 1;
+            found[4 * static_cast<size_t>(i) + dir] = fenwick.query(pos);
+            fenwick.update(pos, px[i] + py[i], i);
+        }
+    }
+
+    // 同一点对可能在多个扇区中被找到：点i的重复项只保留第一次，
+    // i与j互相找到时只由较小下标一侧输出
+    edges.reserve(2 * static_cast<size_t>(n));
+    for (int i = 0; i < n; i++) {
+        const int* mine = &found[4 * static_cast<size_t>(i)];
+        for (int dir = 0; dir < 4; dir++) {
+            int j = mine[dir];
+            if (j < 0 || std::find(mine, mine + dir, j) != mine + dir) continue;
+            const int* theirs = &found[4 * static_cast<size_t>(j)];
+            if (j < i && std::find(theirs, theirs + 4, i) != theirs + 4) continue;
+            edges.emplace_back(std::min(i, j), std::max(i, j));
+        }
+    }
+    return static_cast<int>(edges.size());
+}
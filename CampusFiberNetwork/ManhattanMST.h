@@ -0,0 +1,39 @@
+/**
+ * @file ManhattanMST.h
+ * @brief 曼哈顿（L1）距离最小生成树的候选边生成
+ * @class ManhattanMST
+ * @brief 四次坐标变换 + 扫描线 + 树状数组，求每个点在各45°扇区内的L1最近点
+ *
+ * 对每个点，以其为原点把平面分为8个45°扇区，L1最小生成树中该点的边
+ * 只可能连向每个扇区内L1距离最近的点。利用对称性只需处理4个扇区，
+ * 每个扇区一次O(n log n)扫描，共得到至多4n条候选边，对其运行Kruskal即得精确的L1最小生成树。
+ */
+
+#ifndef MANHATTAN_MST_H
+#define MANHATTAN_MST_H
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+class ManhattanMST {
+public:
+    // 两点间的曼哈顿距离
+    static double distance(double x1, double y1, double x2, double y2) {
+        return std::fabs(x1 - x2) + std::fabs(y1 - y2);
+    }
+
+    /**
+     * @brief 生成包含L1最小生成树的候选边
+     * @param xs 点的X坐标数组
+     * @param ys 点的Y坐标数组
+     * @param n 点的数量
+     * @param edges 输出：无重复的边（顶点下标对，first < second），至多4n条
+     * @return 输出的边数
+     * @note 耗时O(n log n)，内存O(n)
+     */
+    static int candidateEdges(const double* xs, const double* ys, int n,
+                              std::vector<std::pair<int, int>>& edges);
+};
+
+#endif // MANHATTAN_MST_H
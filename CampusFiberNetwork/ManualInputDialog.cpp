@@ -3,6 +3,7 @@
 #include <QRandomGenerator>
 #include <QKeyEvent>
 #include <QDoubleSpinBox>
+#include <utility>
 
 // 实现自定义样式类的drawControl方法
 void CustomSpinBoxStyle::drawControl(ControlElement element, const QStyleOption* option, QPainter* painter, const QWidget* widget) const
@@ -138,16 +139,19 @@ void ManualInputDialog::onAddNodeBtnClicked()
     nodeTableWidget->setCellWidget(row, 2, ySpinBox);
 
     // 记录新添加的节点
-    Node node(xSpinBox->value(), ySpinBox->value());
-    nodes.append(node);
+    nodes.add(xSpinBox->value(), ySpinBox->value());
     nodeCount++;
 
     // 连接信号以便实时更新
     connect(xSpinBox, QOverload<double>::of(&QDoubleSpinBox::valueChanged), [=](double value) {
-        nodes[row].setX(value);
+        if (row < nodes.size()) {
+            nodes.setX(row, value);
+        }
     });
     connect(ySpinBox, QOverload<double>::of(&QDoubleSpinBox::valueChanged), [=](double value) {
-        nodes[row].setY(value);
+        if (row < nodes.size()) {
+            nodes.setY(row, value);
+        }
     });
     
     // 自动选中新添加的行
@@ -189,22 +193,12 @@ void ManualInputDialog::onAccepted()
     if (graph) {
         delete graph;
     }
-    graph = new Graph(nodeCount);
-
-    // 将节点转换为边，边的权重由欧几里得距离确定
-    Node** nodeArray = new Node*[nodeCount];
-    for (int i = 0; i < nodeCount; i++) {
-        nodeArray[i] = new Node(nodes[i].getX(), nodes[i].getY());
+    // 图移动接管节点坐标，边的权重由欧几里得距离确定
+    graph = new Graph(std::move(nodes));
+    if (nodeCount > 1) {
+        NodesToEdges(*graph);
     }
-    
-    // 使用外部函数NodesToEdges将节点转换为边
-    NodesToEdges(*graph, nodeArray, nodeCount);
-    
-    // 释放节点数组
-    for (int i = 0; i < nodeCount; i++) {
-        delete nodeArray[i];
-    }
-    delete[] nodeArray;
+    nodes.clear();
 
     // 接受对话框
     accept();
@@ -237,9 +231,9 @@ void ManualInputDialog::onTableCellChanged(int row, int column)
         if (spinBox) {
             double value = spinBox->value();
             if (column == 1) {
-                nodes[row].setX(value);
+                nodes.setX(row, value);
             } else {
-                nodes[row].setY(value);
+                nodes.setY(row, value);
             }
         }
     }
@@ -256,15 +250,15 @@ void ManualInputDialog::updateNodeTable()
 bool ManualInputDialog::validateInput()
 {
     // 检查是否有节点
-    if (nodes.isEmpty()) {
+    if (nodes.empty()) {
         QMessageBox::warning(this, "错误", "至少需要添加一个节点");
         return false;
     }
 
     // 检查是否有重复坐标的节点
     QSet<QString> coordSet;
-    for (const Node &node : nodes) {
-        QString key = QString("%1-%2").arg(node.getX()).arg(node.getY());
+    for (int i = 0; i < nodes.size(); ++i) {
+        QString key = QString("%1-%2").arg(nodes.getX(i)).arg(nodes.getY(i));
         if (coordSet.contains(key)) {
             QMessageBox::warning(this, "错误", "存在相同坐标的节点");
             return false;
@@ -282,7 +276,3 @@ Graph *ManualInputDialog::getGraph()
     return temp;
 }
 
-QVector<Node> ManualInputDialog::getNodes() const
-{
-    return nodes;
-}
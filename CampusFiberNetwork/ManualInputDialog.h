@@ -15,7 +15,7 @@
 #include <QPainter>
 #include <QPointF>
 #include "Graph.h"
-#include "Node.h"
+#include "NodeSet.h"
 
 // 自定义样式类，用于绘制+和-符号
 class CustomSpinBoxStyle : public QProxyStyle
@@ -33,8 +33,7 @@ public:
     explicit ManualInputDialog(QWidget *parent = nullptr);
     ~ManualInputDialog();
 
-    Graph *getGraph();
-    QVector<Node> getNodes() const; // 添加获取节点列表的方法
+    Graph *getGraph(); // 接受后取得所建的图（节点坐标由图接管，可用getNodeX/getNodeY读取）
 
 protected:
     bool eventFilter(QObject *obj, QEvent *event) override;
@@ -60,7 +59,7 @@ private:
     // 数据
     int nodeCount;
     Graph *graph;
-    QVector<Node> nodes;
+    NodeSet nodes;
     CustomSpinBoxStyle *customStyle; // 自定义样式实例
 };
 
@@ -0,0 +1,54 @@
+/**
+ * @file NodeSet.cpp
+ * @brief 节点坐标容器实现文件
+ */
+
+#include "NodeSet.h"
+#include <cmath>
+
+NodeSet::NodeSet(int n) {
+    resize(n);
+}
+
+void NodeSet::reserve(int n) {
+    if (n > 0) {
+        xs.reserve(n);
+        ys.reserve(n);
+    }
+}
+
+void NodeSet::resize(int n) {
+    if (n < 0) {
+        n = 0;
+    }
+    xs.resize(n, 0.0);
+    ys.resize(n, 0.0);
+}
+
+void NodeSet::clear() {
+    xs.clear();
+    ys.clear();
+}
+
+int NodeSet::add(double x, double y) {
+    xs.push_back(x);
+    ys.push_back(y);
+    return size() - 1;
+}
+
+void NodeSet::remove(int index) {
+    if (index < 0 || index >= size()) {
+        return;
+    }
+    xs.erase(xs.begin() + index);
+    ys.erase(ys.begin() + index);
+}
+
+bool NodeSet::allFinite() const {
+    for (int i = 0; i < size(); i++) {
+        if (!std::isfinite(xs[i]) || !std::isfinite(ys[i])) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file NodeSet.h
+ * @brief 节点坐标的连续存储容器
+ * @class NodeSet
+ * @brief 按结构数组（SoA）存放节点坐标：X、Y各一段按缓存行对齐的连续double数组
+ *
+ * 取代逐个new出的Node对象与Node*指针数组：坐标只写入一次，Graph通过移动接管，
+ * 建边时直接把xData()/yData()交给DistanceKernel及各候选边生成器，无需float到double的转换
+ * 或逐节点的堆分配。节点下标即图的顶点下标。
+ */
+
+#ifndef NODE_SET_H
+#define NODE_SET_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+// 按Alignment字节对齐分配内存的分配器（C++17对齐new）
+template <typename T, std::size_t Alignment>
+struct AlignedAllocator {
+    typedef T value_type;
+
+    template <typename U>
+    struct rebind {
+        typedef AlignedAllocator<U, Alignment> other;
+    };
+
+    AlignedAllocator() noexcept {}
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+    void deallocate(T* p, std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+class NodeSet {
+public:
+    static const std::size_t ALIGNMENT = 64; // 坐标数组按缓存行对齐
+    typedef std::vector<double, AlignedAllocator<double, ALIGNMENT>> CoordinateArray;
+
+private:
+    CoordinateArray xs; // 节点X坐标
+    CoordinateArray ys; // 节点Y坐标
+
+public:
+    NodeSet() {}
+    explicit NodeSet(int n);           // n个位于原点的节点
+
+    int size() const { return static_cast<int>(xs.size()); }
+    bool empty() const { return xs.empty(); }
+    void reserve(int n);
+    void resize(int n);                // 新增的节点位于原点
+    void clear();
+
+    int add(double x, double y);       // 追加节点，返回其下标
+    void remove(int index);            // 删除节点，其后的节点下标减一
+
+    // 坐标访问（调用方保证下标有效）
+    double getX(int index) const { return xs[index]; }
+    double getY(int index) const { return ys[index]; }
+    void setX(int index, double x) { xs[index] = x; }
+    void setY(int index, double y) { ys[index] = y; }
+    void set(int index, double x, double y) { xs[index] = x; ys[index] = y; }
+
+    // 连续坐标数组，供批量计算使用
+    const double* xData() const { return xs.data(); }
+    const double* yData() const { return ys.data(); }
+
+    // 所有坐标是否均为有限值（非NaN、非无穷）
+    bool allFinite() const;
+};
+
+#endif // NODE_SET_H
@@ -0,0 +1,122 @@
+/**
+ * @file ParallelSort.h
+ * @brief 基于线程池的并行归并排序
+ *
+ * 把数组等分为若干块，各块由调用方提供的串行排序（堆排序、基数排序等）并行排好，
+ * 再逐轮两两归并。每次归并按输出位置切分为多段（merge path：二分求出每个输出位置
+ * 在两个输入中的分界），各段独立并行，因此最后几轮也能用满所有线程。
+ * 归并时相等元素先取左侧，结果与串行稳定排序一致；比较为全序时与任何正确排序的结果相同。
+ */
+
+#ifndef PARALLEL_SORT_H
+#define PARALLEL_SORT_H
+
+#include "ThreadPool.h"
+#include <algorithm>
+#include <vector>
+
+namespace ParallelSort {
+
+/**
+ * @brief 求归并a[0,la)与b[0,lb)的前k个输出中来自a的元素个数（相等时a优先）
+ */
+template <typename T, typename Less>
+int mergeSplit(const T* a, int la, const T* b, int lb, int k, Less less) {
+    int lo = std::max(0, k - lb);
+    int hi = std::min(k, la);
+    while (lo < hi) {
+        int i = lo + (hi - lo) / 2;
+        int j = k - i;
+        // a[i]不晚于b[j-1]输出时，前k个输出中a的个数大于i
+        if (!less(b[j - 1], a[i])) {
+            lo = i + 1;
+        }
+        else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+/**
+ * @brief 并行归并排序
+ * @param pool 线程池
+ * @param data 待排序数组，结果写回原处
+ * @param buffer 与data等长的辅助数组
+ * @param n 元素个数
+ * @param less 严格弱序比较
+ * @param leafSort 块内串行排序，调用形式为leafSort(chunk, first, count)，chunk为块编号
+ * @param chunks 块数（>=1），通常取线程数
+ * @param runStart 各有序段边界的辅助数组，由调用方持有以便复用容量
+ * @note 排序本身不分配堆内存：边界原地压缩，线程池调度状态也复用
+ */
+template <typename T, typename Less, typename LeafSort>
+void mergeSort(ThreadPool& pool, T* data, T* buffer, int n, Less less, LeafSort leafSort, int chunks,
+               std::vector<int>& runStart) {
+    if (n <= 0) {
+        return;
+    }
+    chunks = std::max(1, std::min(chunks, n));
+
+    // 各块边界与块内排序
+    runStart.resize(chunks + 1);
+    for (int c = 0; c <= chunks; c++) {
+        runStart[c] = static_cast<int>(static_cast<long long>(n) * c / chunks);
+    }
+    pool.parallelFor(0, chunks, 1, [&](int first, int last) {
+        for (int c = first; c < last; c++) {
+            leafSort(c, data + runStart[c], runStart[c + 1] - runStart[c]);
+        }
+    });
+
+    // 逐轮两两归并，每对按输出位置切成若干段并行执行
+    T* src = data;
+    T* dst = buffer;
+    const int threads = pool.getThreadCount();
+    while (runStart.size() > 2) {
+        int runCount = static_cast<int>(runStart.size()) - 1;
+        int pairCount = (runCount + 1) / 2;
+        int piecesPerPair = std::max(1, (threads * 2 + pairCount - 1) / pairCount);
+
+        pool.parallelFor(0, pairCount * piecesPerPair, 1, [&](int first, int last) {
+            for (int task = first; task < last; task++) {
+                int pair = task / piecesPerPair;
+                int piece = task % piecesPerPair;
+                int aBegin = runStart[2 * pair];
+                int aEnd = runStart[std::min(2 * pair + 1, runCount)];
+                int bEnd = runStart[std::min(2 * pair + 2, runCount)];
+                int la = aEnd - aBegin;
+                int lb = bEnd - aEnd;
+                int total = la + lb;
+                int k0 = static_cast<int>(static_cast<long long>(total) * piece / piecesPerPair);
+                int k1 = static_cast<int>(static_cast<long long>(total) * (piece + 1) / piecesPerPair);
+                if (k0 == k1) continue;
+
+                const T* a = src + aBegin;
+                const T* b = src + aEnd;
+                int i0 = mergeSplit(a, la, b, lb, k0, less);
+                int i1 = mergeSplit(a, la, b, lb, k1, less);
+                std::merge(a + i0, a + i1, b + (k0 - i0), b + (k1 - i1), dst + aBegin + k0, less);
+            }
+        });
+
+        // 归并后的新边界：保留偶数下标的边界，原地压缩
+        for (int r = 0; r < pairCount; r++) {
+            runStart[r] = runStart[2 * r];
+        }
+        runStart[pairCount] = n;
+        runStart.resize(pairCount + 1);
+        std::swap(src, dst);
+    }
+
+    // 结果在辅助数组中时并行拷回
+    if (src != data) {
+        pool.parallelFor(0, n, 0, [&](int first, int last) {
+            std::copy(src + first, src + last, data + first);
+        });
+    }
+}
+
+} // namespace ParallelSort
+
+#endif // PARALLEL_SORT_H
@@ -0,0 +1,69 @@
+/**
+ * @file RollbackUnionFind.cpp
+ * @brief 可撤销并查集实现文件
+ */
+
+#include "RollbackUnionFind.h"
+
+RollbackUnionFind::RollbackUnionFind(int n) : setCount(0) {
+    reset(n);
+}
+
+void RollbackUnionFind::reset(int n) {
+    if (n < 0) {
+        n = 0;
+    }
+    parent.resize(n);
+    rank.assign(n, 0);
+    for (int i = 0; i < n; ++i) {
+        parent[i] = i;
+    }
+    history.clear();
+    setCount = n;
+}
+
+int RollbackUnionFind::find(int x) const {
+    while (parent[x] != x) {
+        x = parent[x];
+    }
+    return x;
+}
+
+bool RollbackUnionFind::unite(int x, int y) {
+    int rootX = find(x);
+    int rootY = find(y);
+    if (rootX == rootY) {
+        return false;
+    }
+
+    // 按秩合并：秩较小的根挂到秩较大的根下
+    if (rank[rootX] < rank[rootY]) {
+        int t = rootX;
+        rootX = rootY;
+        rootY = t;
+    }
+    bool increased = rank[rootX] == rank[rootY];
+    parent[rootY] = rootX;
+    if (increased) {
+        rank[rootX]++;
+    }
+    history.push_back(Undo{ rootY, increased });
+    setCount--;
+    return true;
+}
+
+void RollbackUnionFind::rollback(int checkpoint) {
+    if (checkpoint < 0) {
+        checkpoint = 0;
+    }
+    while (static_cast<int>(history.size()) > checkpoint) {
+        const Undo& undo = history.back();
+        int root = parent[undo.child];
+        if (undo.rankIncreased) {
+            rank[root]--;
+        }
+        parent[undo.child] = undo.child;
+        history.pop_back();
+        setCount++;
+    }
+}
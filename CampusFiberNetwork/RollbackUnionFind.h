@@ -0,0 +1,55 @@
+/**
+ * @file RollbackUnionFind.h
+ * @brief 可撤销的并查集
+ * @class RollbackUnionFind
+ * @brief 按秩合并、不做路径压缩，每次合并记入撤销栈，可回滚到任意检查点
+ *
+ * 路径压缩会改动查找路径上的所有节点，无法按合并逐次撤销；只按秩合并时，
+ * 一次合并只修改一个根的父指针（及另一根的秩），树高不超过log2(n)，
+ * find为O(log n)，回滚每次合并O(1)。供按时间线分治的离线算法使用（见WhatIfMST）。
+ */
+
+#ifndef ROLLBACK_UNION_FIND_H
+#define ROLLBACK_UNION_FIND_H
+
+#include <vector>
+
+class RollbackUnionFind {
+private:
+    // 一次合并的撤销记录
+    struct Undo {
+        int child;          // 被挂到另一棵树下的根
+        bool rankIncreased; // 新根的秩是否加了1
+    };
+
+    std::vector<int> parent;   // 父节点，根指向自身
+    std::vector<int> rank;     // 秩（树高上界）
+    std::vector<Undo> history; // 撤销栈
+    int setCount;              // 当前集合数
+
+public:
+    // 构造函数：初始化大小为 n 的并查集
+    explicit RollbackUnionFind(int n);
+
+    // 重置为 n 个独立集合并清空撤销栈
+    void reset(int n);
+
+    // 查找元素 x 所在集合的根，不修改任何状态，O(log n)
+    int find(int x) const;
+
+    // 合并 x 和 y 所在的集合；已在同一集合时返回false且不记录
+    bool unite(int x, int y);
+
+    // 检查元素 x 和 y 是否属于同一集合
+    bool isConnected(int x, int y) const { return find(x) == find(y); }
+
+    // 当前状态的检查点（撤销栈深度）
+    int checkpoint() const { return static_cast<int>(history.size()); }
+
+    // 撤销检查点之后的所有合并，恢复到调用checkpoint()时的状态
+    void rollback(int checkpoint);
+
+    int getSetCount() const { return setCount; }
+};
+
+#endif // ROLLBACK_UNION_FIND_H
@@ -0,0 +1,176 @@
+/**
+ * @file SpatialGrid.cpp
+ * @brief 均匀网格空间哈希与候选边生成实现文件
+ */
+
+#include "SpatialGrid.h"
+#include "Delaunay.h"
+#include "UnionFind.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// 网格不适合当前数据时（点过度聚集或分量间距过大）的工作量上限，均以点数的倍数计
+const long long PAIR_BUDGET_PER_POINT = 16; // 第一步候选点对数
+const long long SCAN_BUDGET_PER_POINT = 64; // 扩大半径时访问的点数
+
+} // namespace
+
+SpatialGrid::SpatialGrid(const double* xs, const double* ys, int n)
+    : xs(xs), ys(ys), count(n), minX(0.0), minY(0.0), cellSize(1.0), cols(1), rows(1) {
+    if (n <= 0) {
+        cellStart.assign(2, 0);
+        return;
+    }
+
+    double maxX = xs[0], maxY = ys[0];
+    minX = xs[0];
+    minY = ys[0];
+    for (int i = 1; i < n; i++) {
+        minX = std::min(minX, xs[i]);
+        maxX = std::max(maxX, xs[i]);
+        minY = std::min(minY, ys[i]);
+        maxY = std::max(maxY, ys[i]);
+    }
+
+    // 平均每格约2个点；退化为线段时按长度取边长，全部重合时只用一个方格
+    double width = maxX - minX;
+    double height = maxY - minY;
+    double areaSize = std::sqrt(width * height * 2.0 / n);
+    double lineSize = std::max(width, height) * 2.0 / n;
+    cellSize = std::max(areaSize, lineSize);
+    if (!(cellSize > 0.0)) {
+        cellSize = 1.0;
+    }
+    cols = static_cast<int>(width / cellSize) + 1;
+    rows = static_cast<int>(height / cellSize) + 1;
+
+    // 计数排序分桶
+    int cells = cols * rows;
+    cellStart.assign(static_cast<size_t>(cells) + 1, 0);
+    std::vector<int> cellOf(n);
+    for (int i = 0; i < n; i++) {
+        cellOf[i] = cellY(ys[i]) * cols + cellX(xs[i]);
+        cellStart[cellOf[i] + 1]++;
+    }
+    for (int c = 0; c < cells; c++) {
+        cellStart[c + 1] += cellStart[c];
+    }
+    cellPoints.resize(n);
+    std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+    for (int i = 0; i < n; i++) {
+        cellPoints[fill[cellOf[i]]++] = i;
+    }
+}
+
+int SpatialGrid::cellX(double x) const {
+    int c = static_cast<int>((x - minX) / cellSize);
+    return c < 0 ? 0 : (c >= cols ? cols - 1 : c);
+}
+
+int SpatialGrid::cellY(double y) const {
+    int c = static_cast<int>((y - minY) / cellSize);
+    return c < 0 ? 0 : (c >= rows ? rows - 1 : c);
+}
+
+/**
+ * @brief 网格候选边 + 按需扩大半径
+ *
+ * 不变式：合并完半径r内的候选边后，任一距离不超过r的点对要么在候选集中，
+ * 要么两端已由更短的候选边连通（Kruskal必然跳过）。扩大到2r时只需加入
+ * 距离在(r, 2r]内的跨分量点对；分量内部的点对已由不超过r的边连通，无需加入。
+ * 只需连通性而非边的顺序，因此不必排序。跨分量点对只需从一端查找，
+ * 故最大分量的点不参与搜索。
+ * 点过度聚集或分量相距过远时网格退化，工作量超过上限后改用Delaunay候选边，结果同样精确
+ * （Delaunay的方向与外接圆判定为精确谓词，不会在近似共线的点集上漏边）。
+ */
+int SpatialGrid::candidateEdges(const double* xs, const double* ys, int n,
+                                std::vector<std::pair<int, int>>& edges) {
+    edges.clear();
+    if (n < 2) {
+        return 0;
+    }
+
+    SpatialGrid grid(xs, ys, n);
+    double s = grid.getCellSize();
+    auto dist2 = [&](int a, int b) {
+        double dx = xs[a] - xs[b];
+        double dy = ys[a] - ys[b];
+        return dx * dx + dy * dy;
+    };
+    auto fallback = [&]() {
+        return Delaunay::triangulateEdges(xs, ys, n, edges);
+    };
+
+    UnionFind uf(n);
+    int components = n;
+    auto addEdge = [&](int u, int v) {
+        edges.emplace_back(u, v);
+        if (uf.find(u) != uf.find(v)) {
+            uf.unite(u, v);
+            components--;
+        }
+    };
+
+    // 第一步：所有距离不超过s的点对（3x3邻域）
+    long long pairBudget = PAIR_BUDGET_PER_POINT * n;
+    double limit2 = s * s;
+    edges.reserve(4 * static_cast<size_t>(n));
+    for (int p = 0; p < n; p++) {
+        grid.forEachNear(p, 1, [&](int q) {
+            if (q > p && dist2(p, q) <= limit2) {
+                addEdge(p, q);
+            }
+        });
+        if (static_cast<long long>(edges.size()) > pairBudget) {
+            return fallback();
+        }
+    }
+
+    std::vector<int> labels(n);
+    std::vector<int> componentSize(n);
+    std::vector<std::pair<int, int>> pending;
+    long long scanBudget = SCAN_BUDGET_PER_POINT * n;
+
+    for (int ring = 1; components > 1; ring *= 2) {
+        // 找出最大分量，只为其余分量扩大半径
+        std::fill(componentSize.begin(), componentSize.end(), 0);
+        int largest = 0;
+        for (int i = 0; i < n; i++) {
+            labels[i] = uf.find(i);
+            if (++componentSize[labels[i]] > componentSize[largest]) {
+                largest = labels[i];
+            }
+        }
+
+        int nextRing = ring * 2;
+        double inner2 = (ring * s) * (ring * s);
+        double outer2 = (nextRing * s) * (nextRing * s);
+        pending.clear();
+        for (int p = 0; p < n; p++) {
+            int cp = labels[p];
+            if (cp == largest) continue;
+            grid.forEachNear(p, nextRing, [&](int q) {
+                scanBudget--;
+                int cq = labels[q];
+                // 跨分量且未在此前的半径内加入；两端都不在最大分量时只由较小下标一端加入
+                if (cq == cp || (cq != largest && q < p)) return;
+                double d2 = dist2(p, q);
+                if (d2 > inner2 && d2 <= outer2) {
+                    pending.emplace_back(std::min(p, q), std::max(p, q));
+                }
+            });
+            if (scanBudget < 0) {
+                return fallback();
+            }
+        }
+
+        // 本轮点对都基于本轮开始时的分量判定，全部加入后再更新连通性
+        for (const auto& e : pending) {
+            addEdge(e.first, e.second);
+        }
+    }
+
+    return static_cast<int>(edges.size());
+}
@@ -0,0 +1,80 @@
+/**
+ * @file SpatialGrid.h
+ * @brief 均匀网格空间哈希，用于分布均匀的点集快速生成欧氏最小生成树候选边
+ * @class SpatialGrid
+ * @brief 按坐标把点分桶到边长为s的方格，只在相邻方格之间连边
+ *
+ * 先取所有距离不超过s的点对（只需查看3x3邻域方格），这些边上的Kruskal结果
+ * 与完全图在长度不超过s的部分完全一致。仍不连通时，只对最大连通分量以外的分量
+ * 成倍扩大搜索半径R，补充其与其他分量之间距离在(上一半径, R]内的点对，直到连通。
+ * 对均匀分布的数据，绝大多数点在第一步即并入最大分量，整体接近线性时间；
+ * 点高度聚集时网格退化（如大量重合点或近似共线的点），超过工作量上限后改用Delaunay候选边；
+ * Delaunay使用精确谓词，退化输入下同样包含欧氏最小生成树（见GraphBenchmark --verify）。
+ */
+
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <utility>
+#include <vector>
+
+class SpatialGrid {
+private:
+    const double* xs;          // 点的X坐标（不拷贝，调用方保证生命周期）
+    const double* ys;          // 点的Y坐标
+    int count;                 // 点数
+    double minX;               // 网格原点X
+    double minY;               // 网格原点Y
+    double cellSize;           // 方格边长
+    int cols;                  // 列数
+    int rows;                  // 行数
+    std::vector<int> cellStart;  // 方格c中的点为cellPoints[cellStart[c], cellStart[c+1])
+    std::vector<int> cellPoints; // 按方格排列的点下标
+
+    int cellX(double x) const;
+    int cellY(double y) const;
+
+public:
+    /**
+     * @brief 在给定坐标上建立网格，O(n)
+     * @note 方格边长按点密度选取，平均每格约2个点；网格总格数为O(n)
+     */
+    SpatialGrid(const double* xs, const double* ys, int n);
+
+    double getCellSize() const { return cellSize; }
+
+    /**
+     * @brief 枚举点p周围Chebyshev方格距离不超过ring的所有点
+     * @param visit 对每个点q调用visit(q)（包含p自身）
+     */
+    template <typename Visitor>
+    void forEachNear(int p, int ring, Visitor visit) const {
+        int cx = cellX(xs[p]);
+        int cy = cellY(ys[p]);
+        int x0 = cx - ring < 0 ? 0 : cx - ring;
+        int x1 = cx + ring >= cols ? cols - 1 : cx + ring;
+        int y0 = cy - ring < 0 ? 0 : cy - ring;
+        int y1 = cy + ring >= rows ? rows - 1 : cy + ring;
+        for (int y = y0; y <= y1; y++) {
+            for (int x = x0; x <= x1; x++) {
+                int c = y * cols + x;
+                for (int k = cellStart[c]; k < cellStart[c + 1]; k++) {
+                    visit(cellPoints[k]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief 生成包含欧氏最小生成树的网格候选边
+     * @param xs 点的X坐标数组
+     * @param ys 点的Y坐标数组
+     * @param n 点的数量
+     * @param edges 输出：无重复的边（顶点下标对，first < second）
+     * @return 输出的边数
+     */
+    static int candidateEdges(const double* xs, const double* ys, int n,
+                              std::vector<std::pair<int, int>>& edges);
+};
+
+#endif // SPATIAL_GRID_H
@@ -0,0 +1,143 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief 工作线程池实现文件
+ */
+
+#include "ThreadPool.h"
+#include <algorithm>
+
+/**
+ * @brief 构造线程池并启动工作线程
+ * @param threadCount 总并行度，<=0 时取硬件并发数
+ */
+ThreadPool::ThreadPool(int threadCount)
+    : stopping(false), jobBusy(false), jobInvoke(nullptr), jobBody(nullptr),
+      jobNext(0), jobEnd(0), jobGrain(1), jobSlots(0), jobActive(0) {
+    if (threadCount <= 0) {
+        threadCount = hardwareThreads();
+    }
+
+    for (int i = 1; i < threadCount; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+/**
+ * @brief 析构：执行完队列中剩余任务后停止所有工作线程
+ */
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueCondition.notify_all();
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+int ThreadPool::hardwareThreads() {
+    unsigned int n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : static_cast<int>(n);
+}
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCondition.wait(lock, [this] { return stopping || jobSlots > 0 || !tasks.empty(); });
+            if (jobSlots > 0) {
+                // 加入当前区间任务；调用方等待jobActive归零后才返回，body在此期间有效
+                jobSlots--;
+                jobActive++;
+                lock.unlock();
+                runJobChunks();
+                lock.lock();
+                if (--jobActive == 0) {
+                    jobDone.notify_one();
+                }
+                continue;
+            }
+            if (stopping && tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        task();
+    }
+}
+
+void ThreadPool::runJobChunks() {
+    while (true) {
+        int chunkBegin = jobNext.fetch_add(jobGrain);
+        if (chunkBegin >= jobEnd) {
+            break;
+        }
+        jobInvoke(jobBody, chunkBegin, std::min(jobEnd, chunkBegin + jobGrain));
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    if (workers.empty()) {
+        // 没有工作线程时直接在调用线程执行
+        task();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        tasks.push(std::move(task));
+    }
+    queueCondition.notify_one();
+}
+
+/**
+ * @brief 并行区间循环
+ * @note 每个参与线程循环领取 [next, next+grain) 块直到区间耗尽；
+ *       调用线程同样参与，并在最后等待已领取任务的工作线程结束
+ */
+void ThreadPool::parallelForImpl(int begin, int end, int grain,
+                                 void (*invoke)(const void*, int, int), const void* body) {
+    if (begin >= end) {
+        return;
+    }
+
+    int total = end - begin;
+    int threads = getThreadCount();
+    if (grain <= 0) {
+        // 每个线程约分到8块，兼顾负载均衡与调度开销
+        grain = std::max(1, total / (threads * 8));
+    }
+
+    int chunks = (total + grain - 1) / grain;
+    bool expected = false;
+    if (threads == 1 || chunks == 1 || !jobBusy.compare_exchange_strong(expected, true)) {
+        invoke(body, begin, end);
+        return;
+    }
+
+    // 发布区间任务，至多chunks-1个工作线程加入
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        jobInvoke = invoke;
+        jobBody = body;
+        jobNext.store(begin);
+        jobEnd = end;
+        jobGrain = grain;
+        jobSlots = std::min(threads - 1, chunks - 1);
+    }
+    queueCondition.notify_all();
+
+    runJobChunks();
+
+    // 收回未被领取的名额，等待已加入的工作线程结束
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        jobSlots = 0;
+        jobDone.wait(lock, [this] { return jobActive == 0; });
+    }
+    jobBusy.store(false);
+}
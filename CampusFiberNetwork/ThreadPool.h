@@ -0,0 +1,84 @@
+/**
+ * @file ThreadPool.h
+ * @brief 固定大小的工作线程池
+ * @class ThreadPool
+ * @brief 任务队列 + 工作线程；parallelFor 将区间切块后由所有线程（含调用线程）动态领取
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;          // 工作线程
+    std::queue<std::function<void()>> tasks;   // 待执行任务
+    std::mutex queueMutex;                     // 保护任务队列与当前区间任务的领取计数
+    std::condition_variable queueCondition;    // 通知有新任务、新区间任务或停止
+    bool stopping;                             // 线程池正在析构
+
+    // 当前parallelFor的区间任务（每个线程池一份，重复调用不分配堆内存）
+    std::atomic<bool> jobBusy;                 // 已有parallelFor在执行
+    void (*jobInvoke)(const void*, int, int);  // 调用body的函数
+    const void* jobBody;                       // 调用方的body
+    std::atomic<int> jobNext;                  // 下一个待领取块的起点
+    int jobEnd;                                // 区间终点
+    int jobGrain;                              // 块大小
+    int jobSlots;                              // 尚可加入的工作线程数（queueMutex保护）
+    int jobActive;                             // 正在执行的工作线程数（queueMutex保护）
+    std::condition_variable jobDone;           // 通知参与的工作线程已全部结束
+
+    // 工作线程主循环
+    void workerLoop();
+    // 循环领取并执行当前区间任务的块
+    void runJobChunks();
+    // parallelFor的类型擦除实现
+    void parallelForImpl(int begin, int end, int grain, void (*invoke)(const void*, int, int), const void* body);
+
+public:
+    /**
+     * @brief 构造线程池
+     * @param threadCount 总并行度（含调用线程），<=0 时取硬件并发数
+     * @note 实际创建 threadCount-1 个工作线程，调用线程在 parallelFor 中也参与计算
+     */
+    explicit ThreadPool(int threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // 总并行度（工作线程数 + 调用线程）
+    int getThreadCount() const { return static_cast<int>(workers.size()) + 1; }
+
+    // 提交一个独立任务
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief 并行执行 body(chunkBegin, chunkEnd)，覆盖区间[begin, end)
+     * @param begin 区间起点
+     * @param end 区间终点（不含）
+     * @param grain 每次领取的块大小，<=0 时自动选择
+     * @param body 块处理函数，不同块可能在不同线程上并发执行
+     * @note 块通过原子计数器动态分配（work-sharing），返回前等待所有块完成。
+     *       body按引用传递、不做拷贝，调度状态为线程池成员，调用本身不分配堆内存。
+     *       线程池已有parallelFor在执行时（嵌套或并发调用），本次在调用线程上串行执行
+     */
+    template <typename Body>
+    void parallelFor(int begin, int end, int grain, const Body& body) {
+        parallelForImpl(begin, end, grain,
+            [](const void* b, int first, int last) { (*static_cast<const Body*>(b))(first, last); },
+            &body);
+    }
+
+    // 硬件并发数（至少为1）
+    static int hardwareThreads();
+};
+
+#endif // THREAD_POOL_H
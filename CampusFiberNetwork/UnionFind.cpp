@@ -1,7 +1,7 @@
 #include "UnionFind.h"
 
 // 캯ʼ鼯ÿԪԳһ
-UnionFind::UnionFind(int n) : size(n) {
+UnionFind::UnionFind(int n) : size(n), capacity(n) {
     parent = new int[n];
     rank = new int[n];
 
@@ -18,6 +18,23 @@ UnionFind::~UnionFind() {
     delete[] rank;
 }
 
+// ãʱ·䣬֮ÿԪԳһ
+void UnionFind::reset(int n) {
+    if (n > capacity) {
+        delete[] parent;
+        delete[] rank;
+        parent = new int[n];
+        rank = new int[n];
+        capacity = n;
+    }
+    size = n;
+
+    for (int i = 0; i < n; ++i) {
+        parent[i] = i;
+        rank[i] = 0;
+    }
+}
+
 // Find·ѹ
 int UnionFind::find(int x) {
     // Ҹڵ
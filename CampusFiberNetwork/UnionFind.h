@@ -6,6 +6,7 @@ private:
     int* parent;   // 洢ÿԪصĸڵ
     int* rank;     // 洢ԸԪΪȣ߶Ͻ磩
     int size;      // Ԫص
+    int capacity;  // ѷresetʱ·䣩
 
 public:
     // 캯ʼСΪ n Ĳ鼯
@@ -14,6 +15,9 @@ public:
     // ͷŶ̬ڴ
     ~UnionFind();
 
+    // Ϊ n ϣn ʱڴ棬ѷ
+    void reset(int n);
+
     // Ԫ x ڼϵĸԪأ·ѹŻ
     int find(int x);
 
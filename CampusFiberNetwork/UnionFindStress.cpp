@@ -0,0 +1,286 @@
+/**
+ * @file UnionFindStress.cpp
+ * @brief 并查集压力测试与基准程序（不依赖Qt）
+ *
+ * 在带种子的随机操作序列上，对比串行UnionFind（按秩合并+路径压缩）与
+ * 多线程并发执行的ConcurrentUnionFind（无锁），每个测量结果输出一行JSON（JSON Lines）。
+ * 每次并发运行结束后与串行结果逐元素比对划分，不一致时向标准错误报告并以返回值2退出。
+ *
+ * 用法：
+ *   UnionFindStress [--sizes 100000,1000000,10000000] [--threads 1,2,4,8]
+ *                   [--repeat 3] [--seed 42] [--out result.jsonl]
+ *
+ * 负载（每种负载的操作数为元素数的2倍）：
+ *   unite   随机元素对直接unite
+ *   mixed   先isConnected判断，不连通再unite（同GraphBenchmark中的UnionFind测量与Kruskal的用法）
+ *   hot     每个操作的一端落在64个热点元素中，各线程集中竞争少数几个根的CAS
+ * 输出字段：
+ *   bench, workload, threads, nodes, ops, iterations, seed,
+ *   ns_per_op（最快一次迭代）, mean_ns_per_op, ops_per_sec, speedup（相对串行UnionFind）,
+ *   sets（结束时的集合数）, verified
+ * --threads 默认取1、2、4……直到硬件并发数；可以超过硬件并发数以测试超订下的正确性。
+ */
+
+#include "BenchmarkUtil.h"
+#include "ConcurrentUnionFind.h"
+#include "ThreadPool.h"
+#include "UnionFind.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Benchmark::Clock;
+using Benchmark::JsonFields;
+using Benchmark::Measurement;
+using Benchmark::Reporter;
+using Benchmark::SeededRandom;
+using Benchmark::elapsedNs;
+
+// 负载类型
+enum class Workload {
+    Unite, // 随机元素对直接合并
+    Mixed, // 先判断连通再合并
+    Hot    // 一端集中在少数热点元素上
+};
+
+const char* workloadName(Workload workload) {
+    switch (workload) {
+    case Workload::Unite: return "unite";
+    case Workload::Mixed: return "mixed";
+    case Workload::Hot: return "hot";
+    }
+    return "unknown";
+}
+
+const int HOT_ELEMENTS = 64;
+
+// 生成ops个操作的元素对，pairs[2i]与pairs[2i+1]为第i个操作的两端
+std::vector<int> generatePairs(Workload workload, int n, long long ops, uint64_t seed) {
+    SeededRandom rng(seed ^ 0x5DEECE66DULL);
+    std::vector<int> pairs(2 * static_cast<size_t>(ops));
+    int hot = std::min(n, HOT_ELEMENTS);
+    for (long long i = 0; i < ops; i++) {
+        pairs[2 * i] = rng.below(n);
+        pairs[2 * i + 1] = workload == Workload::Hot ? rng.below(hot) : rng.below(n);
+    }
+    return pairs;
+}
+
+// 并查集的一项测量：在公共部分之外记录负载、线程数与校验结果
+struct StressMeasurement : Measurement {
+    Workload workload;
+    int threads;
+    int sets;        // 结束时的集合数
+    bool verified;
+};
+
+// baselineNs为同一负载下串行UnionFind的最快一次迭代耗时
+void report(Reporter& reporter, const StressMeasurement& m, long long baselineNs) {
+    long long best = m.bestNs();
+    double opsPerSec = best > 0 ? m.ops * 1e9 / best : 0.0;
+    double speedup = best > 0 ? static_cast<double>(baselineNs) / best : 0.0;
+    reporter.report(m,
+        JsonFields().addString("workload", workloadName(m.workload)).addInt("threads", m.threads),
+        JsonFields().addFixed("ops_per_sec", opsPerSec, 1).addFixed("speedup", speedup, 3)
+            .addInt("sets", m.sets).addBool("verified", m.verified));
+}
+
+struct Options {
+    std::vector<int> sizes{100000, 1000000, 10000000};
+    std::vector<int> threads;
+    int repeat = 3;
+    uint64_t seed = 42;
+    std::string outPath;
+};
+
+bool parseList(const char* text, std::vector<int>& values, long minValue, long maxValue) {
+    values.clear();
+    std::string s(text);
+    size_t pos = 0;
+    while (pos <= s.size()) {
+        size_t comma = s.find(',', pos);
+        if (comma == std::string::npos) comma = s.size();
+        long value = std::strtol(s.substr(pos, comma - pos).c_str(), nullptr, 10);
+        if (value < minValue || value > maxValue) return false;
+        values.push_back(static_cast<int>(value));
+        pos = comma + 1;
+    }
+    return !values.empty();
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--sizes") == 0 && hasValue) {
+            if (!parseList(argv[++i], options.sizes, 2, 100000000)) return false;
+        }
+        else if (std::strcmp(arg, "--threads") == 0 && hasValue) {
+            if (!parseList(argv[++i], options.threads, 1, 1024)) return false;
+        }
+        else if (std::strcmp(arg, "--repeat") == 0 && hasValue) {
+            options.repeat = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (std::strcmp(arg, "--out") == 0 && hasValue) {
+            options.outPath = argv[++i];
+        }
+        else {
+            return false;
+        }
+    }
+    if (options.threads.empty()) {
+        int hardware = ThreadPool::hardwareThreads();
+        for (int t = 1; t < hardware; t *= 2) {
+            options.threads.push_back(t);
+        }
+        options.threads.push_back(hardware);
+    }
+    return true;
+}
+
+// 串行基准：UnionFind按顺序执行全部操作
+StressMeasurement benchUnionFind(const std::vector<int>& pairs, Workload workload, int n, int repeat,
+                                 UnionFind& uf) {
+    long long ops = static_cast<long long>(pairs.size() / 2);
+    StressMeasurement m{{"UnionFind", n, ops, {}}, workload, 1, 0, true};
+    for (int r = 0; r < repeat; r++) {
+        uf.reset(n);
+        Clock::time_point start = Clock::now();
+        for (long long i = 0; i < ops; i++) {
+            int a = pairs[2 * i];
+            int b = pairs[2 * i + 1];
+            if (workload == Workload::Mixed) {
+                if (!uf.isConnected(a, b)) {
+                    uf.unite(a, b);
+                }
+            }
+            else {
+                uf.unite(a, b);
+            }
+        }
+        Clock::time_point end = Clock::now();
+        m.iterationNs.push_back(elapsedNs(start, end));
+    }
+    return m;
+}
+
+/**
+ * @brief 检查两个并查集表示的划分是否相同
+ * @note 两边的根可能不同，要求"串行根 -> 并发根"的对应是一一映射
+ */
+bool samePartition(UnionFind& expected, ConcurrentUnionFind& actual, int n) {
+    std::vector<int> forward(n, -1);
+    std::vector<int> backward(n, -1);
+    for (int i = 0; i < n; i++) {
+        int e = expected.find(i);
+        int a = actual.find(i);
+        if (forward[e] == -1 && backward[a] == -1) {
+            forward[e] = a;
+            backward[a] = e;
+        }
+        else if (forward[e] != a || backward[a] != e) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 并发测试：操作序列按块动态分给threads个线程，与串行结果比对划分
+StressMeasurement benchConcurrent(const std::vector<int>& pairs, Workload workload, int n, int threads,
+                                  int repeat, UnionFind& expected) {
+    long long ops = static_cast<long long>(pairs.size() / 2);
+    StressMeasurement m{{"ConcurrentUnionFind", n, ops, {}}, workload, threads, 0, true};
+    ThreadPool pool(threads);
+    ConcurrentUnionFind uf(n);
+    for (int r = 0; r < repeat; r++) {
+        uf.reset(n);
+        Clock::time_point start = Clock::now();
+        pool.parallelFor(0, static_cast<int>(ops), 4096, [&](int first, int last) {
+            for (int i = first; i < last; i++) {
+                int a = pairs[2 * static_cast<size_t>(i)];
+                int b = pairs[2 * static_cast<size_t>(i) + 1];
+                if (workload == Workload::Mixed) {
+                    if (!uf.isConnected(a, b)) {
+                        uf.unite(a, b);
+                    }
+                }
+                else {
+                    uf.unite(a, b);
+                }
+            }
+        });
+        Clock::time_point end = Clock::now();
+        m.iterationNs.push_back(elapsedNs(start, end));
+
+        if (!samePartition(expected, uf, n)) {
+            std::cerr << "错误：" << workloadName(workload) << " 负载在 " << threads
+                << " 线程下的划分与串行UnionFind不一致（第" << (r + 1) << "次迭代）" << std::endl;
+            m.verified = false;
+        }
+    }
+    m.sets = uf.countSets();
+    return m;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::cerr << "用法: " << argv[0]
+            << " [--sizes 100000,1000000,...] [--threads 1,2,4,...] [--repeat N] [--seed N] [--out FILE]"
+            << std::endl;
+        return 1;
+    }
+
+    std::ofstream outFile;
+    if (!options.outPath.empty()) {
+        outFile.open(options.outPath);
+        if (!outFile) {
+            std::cerr << "错误：无法打开输出文件 " << options.outPath << std::endl;
+            return 1;
+        }
+    }
+    Reporter reporter(options.outPath.empty() ? std::cout : outFile, options.seed);
+
+    bool allVerified = true;
+    const Workload workloads[] = { Workload::Unite, Workload::Mixed, Workload::Hot };
+    for (int n : options.sizes) {
+        UnionFind expected(n);
+        for (Workload workload : workloads) {
+            std::vector<int> pairs = generatePairs(workload, n, 2LL * n,
+                options.seed + static_cast<uint64_t>(n));
+
+            // 串行结果留在expected中，作为并发运行的参照划分
+            StressMeasurement baseline = benchUnionFind(pairs, workload, n, options.repeat, expected);
+            long long baselineNs = baseline.bestNs();
+            int sets = 0;
+            for (int i = 0; i < n; i++) {
+                if (expected.find(i) == i) sets++;
+            }
+            baseline.sets = sets;
+            report(reporter, baseline, baselineNs);
+
+            for (int threads : options.threads) {
+                StressMeasurement m = benchConcurrent(pairs, workload, n, threads, options.repeat, expected);
+                if (m.sets != sets) {
+                    m.verified = false;
+                }
+                allVerified = allVerified && m.verified;
+                report(reporter, m, baselineNs);
+            }
+        }
+    }
+    return allVerified ? 0 : 2;
+}
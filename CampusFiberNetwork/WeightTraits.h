@@ -0,0 +1,76 @@
+/**
+ * @file WeightTraits.h
+ * @brief 边权类型的编译期特性：排序键、求和类型与距离转换
+ *
+ * BasicGraph<W> 支持 int、long long、float、double 四种边权类型。
+ * 每种类型提供一个与 < 同序的无符号排序键，供基数排序使用：
+ * 整数翻转符号位；浮点数为正时翻转符号位、为负时按位取反（IEEE 754位模式的单调映射）。
+ * 32位类型使用32位键，缓存密度更高；64位类型使用64位键，精度更高。
+ */
+
+#ifndef WEIGHT_TRAITS_H
+#define WEIGHT_TRAITS_H
+
+#include <cstdint>
+#include <cstring>
+
+template <typename W>
+struct WeightTraits; // 只对下列四种类型特化
+
+template <>
+struct WeightTraits<int> {
+    typedef uint32_t Key;   // 基数排序键
+    typedef long long Sum;  // MST总权重的累加类型，避免int溢出
+
+    static Key toKey(int w) { return static_cast<uint32_t>(w) ^ 0x80000000u; }
+
+    // 截断（默认）或四舍五入
+    static int fromDistance(double distance, bool round) {
+        return round ? static_cast<int>(distance + 0.5) : static_cast<int>(distance);
+    }
+};
+
+template <>
+struct WeightTraits<long long> {
+    typedef uint64_t Key;
+    typedef long long Sum;
+
+    static Key toKey(long long w) { return static_cast<uint64_t>(w) ^ 0x8000000000000000ULL; }
+
+    static long long fromDistance(double distance, bool round) {
+        return round ? static_cast<long long>(distance + 0.5) : static_cast<long long>(distance);
+    }
+};
+
+template <>
+struct WeightTraits<float> {
+    typedef uint32_t Key;
+    typedef double Sum;
+
+    static Key toKey(float w) {
+        if (w == 0.0f) w = 0.0f; // -0.0与+0.0相等，统一为同一个键
+        uint32_t bits;
+        std::memcpy(&bits, &w, sizeof(bits));
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+
+    // 浮点边权保留精确距离，round参数只对整数边权有意义
+    static float fromDistance(double distance, bool) { return static_cast<float>(distance); }
+};
+
+template <>
+struct WeightTraits<double> {
+    typedef uint64_t Key;
+    typedef double Sum;
+
+    static Key toKey(double w) {
+        if (w == 0.0) w = 0.0;
+        uint64_t bits;
+        std::memcpy(&bits, &w, sizeof(bits));
+        return (bits & 0x8000000000000000ULL) ? ~bits : (bits | 0x8000000000000000ULL);
+    }
+
+    static double fromDistance(double distance, bool) { return distance; }
+};
+
+#endif // WEIGHT_TRAITS_H
@@ -0,0 +1,186 @@
+/**
+ * @file WhatIfMST.cpp
+ * @brief 离线禁用边最小生成树查询的分治实现
+ */
+
+#include "WhatIfMST.h"
+#include "RollbackUnionFind.h"
+#include "Logger.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+
+template <typename W>
+class Solver {
+private:
+    typedef typename BasicWhatIfMST<W>::GraphType GraphType;
+    typedef typename BasicWhatIfMST<W>::WeightSum WeightSum;
+
+    const BasicEdge<W>* edges;
+    const std::vector<std::vector<int>>& queries;
+    std::vector<typename BasicWhatIfMST<W>::Result>& results;
+    RollbackUnionFind uf;
+    std::vector<int> mark;   // 边 -> 最近一次被标记为未定边时的标记值
+    int currentMark;
+
+    bool less(int a, int b) const { return GraphType::edgeLess(edges[a], edges[b]); }
+
+public:
+    Solver(const GraphType& graph, const std::vector<std::vector<int>>& queries,
+           std::vector<typename BasicWhatIfMST<W>::Result>& results)
+        : edges(graph.getEdges()), queries(queries), results(results), uf(graph.getVertices()),
+          mark(graph.getEdgeCount(), 0), currentMark(0) {
+    }
+
+    /**
+     * @brief 处理查询区间[l, r]
+     * @param fixed 父区间裁减后剩余的固定边，按edgeLess升序
+     * @param parentUndetermined 父区间的未定边
+     * @param weight 已合并（收缩）边的总权重
+     * @param count 已合并边数
+     */
+    void solve(int l, int r, const std::vector<int>& fixed, const std::vector<int>& parentUndetermined,
+               WeightSum weight, int count) {
+        // 本区间的未定边（去重）
+        int undeterminedMark = ++currentMark;
+        std::vector<int> undetermined;
+        for (int q = l; q <= r; q++) {
+            for (int e : queries[q]) {
+                if (mark[e] != undeterminedMark) {
+                    mark[e] = undeterminedMark;
+                    undetermined.push_back(e);
+                }
+            }
+        }
+
+        // 父区间未定、本区间不再被禁用的边转为固定边，与父区间的固定边归并
+        std::vector<int> released;
+        for (int e : parentUndetermined) {
+            if (mark[e] != undeterminedMark) {
+                released.push_back(e);
+            }
+        }
+        std::sort(released.begin(), released.end(), [this](int a, int b) { return less(a, b); });
+        std::vector<int> candidates(fixed.size() + released.size());
+        std::merge(fixed.begin(), fixed.end(), released.begin(), released.end(), candidates.begin(),
+                   [this](int a, int b) { return less(a, b); });
+
+        int entry = uf.checkpoint();
+
+        if (l < r) {
+            // 收缩：未定边全部强制加入，仍被选中的固定边对区间内所有查询都在MST中
+            int probe = uf.checkpoint();
+            for (int e : undetermined) {
+                uf.unite(edges[e].getSrc(), edges[e].getDest());
+            }
+            std::vector<int> forced;
+            for (int e : candidates) {
+                if (uf.unite(edges[e].getSrc(), edges[e].getDest())) {
+                    forced.push_back(e);
+                }
+            }
+            uf.rollback(probe);
+            for (int e : forced) {
+                uf.unite(edges[e].getSrc(), edges[e].getDest());
+                weight += edges[e].getWeight();
+                count++;
+            }
+        }
+
+        // 裁减：未定边全部去掉，仍不被选中的固定边对区间内所有查询都不在MST中
+        int probe = uf.checkpoint();
+        std::vector<int> reduced;
+        WeightSum reducedWeight = 0;
+        for (int e : candidates) {
+            if (uf.unite(edges[e].getSrc(), edges[e].getDest())) {
+                reduced.push_back(e);
+                reducedWeight += edges[e].getWeight();
+            }
+        }
+        uf.rollback(probe);
+
+        if (l == r) {
+            // 单个查询：未定边即其禁用的边，剩余固定边恰好构成该查询MST的其余部分
+            results[l].totalWeight = weight + reducedWeight;
+            results[l].edgeCount = count + static_cast<int>(reduced.size());
+        }
+        else {
+            int mid = l + (r - l) / 2;
+            solve(l, mid, reduced, undetermined, weight, count);
+            solve(mid + 1, r, reduced, undetermined, weight, count);
+        }
+
+        uf.rollback(entry);
+    }
+};
+
+} // namespace
+
+template <typename W>
+void BasicWhatIfMST<W>::forbiddenEdgeQueries(GraphType& graph, const std::vector<std::vector<int>>& forbidden,
+                                             std::vector<Result>& results) {
+    const int queryCount = static_cast<int>(forbidden.size());
+    results.assign(queryCount, Result{ 0, 0 });
+    if (queryCount == 0) {
+        return;
+    }
+
+    // 去掉越界的边下标
+    const int edgeCount = graph.getEdgeCount();
+    std::vector<std::vector<int>> queries(queryCount);
+    for (int q = 0; q < queryCount; q++) {
+        for (int e : forbidden[q]) {
+            if (e < 0 || e >= edgeCount) {
+                std::cerr << "警告：查询 " << q << " 中的边下标 " << e << " 越界，忽略" << std::endl;
+                continue;
+            }
+            queries[q].push_back(e);
+        }
+    }
+
+    LOG_SUMMARY("开始求解 " << queryCount << " 个禁用边查询的最小生成树...");
+
+    // 根区间的固定边：未被任何查询禁用的边，按edgeLess排序
+    std::vector<bool> everForbidden(edgeCount, false);
+    std::vector<int> undetermined;
+    for (const std::vector<int>& query : queries) {
+        for (int e : query) {
+            if (!everForbidden[e]) {
+                everForbidden[e] = true;
+                undetermined.push_back(e);
+            }
+        }
+    }
+    std::vector<int> order;
+    graph.radixSortEdgeOrder(order);
+    std::vector<int> fixed;
+    fixed.reserve(order.size());
+    for (int e : order) {
+        if (!everForbidden[e]) {
+            fixed.push_back(e);
+        }
+    }
+
+    // 根区间没有父区间：全部禁用过的边以"父区间未定边"传入，由根区间按自身未定边筛选
+    Solver<W> solver(graph, queries, results);
+    solver.solve(0, queryCount - 1, fixed, undetermined, 0, 0);
+
+    LOG_SUMMARY("禁用边查询求解完成");
+}
+
+template <typename W>
+void BasicWhatIfMST<W>::forbiddenEdgeQueries(GraphType& graph, const std::vector<int>& forbiddenEdge,
+                                             std::vector<Result>& results) {
+    std::vector<std::vector<int>> forbidden(forbiddenEdge.size());
+    for (size_t q = 0; q < forbiddenEdge.size(); q++) {
+        forbidden[q].push_back(forbiddenEdge[q]);
+    }
+    forbiddenEdgeQueries(graph, forbidden, results);
+}
+
+// 显式实例化：与BasicGraph相同的四种边权类型
+template class BasicWhatIfMST<int>;
+template class BasicWhatIfMST<long long>;
+template class BasicWhatIfMST<float>;
+template class BasicWhatIfMST<double>;
@@ -0,0 +1,56 @@
+/**
+ * @file WhatIfMST.h
+ * @brief 离线"假设"最小生成树查询：禁用若干条边后的MST
+ * @class BasicWhatIfMST
+ * @brief 对一批查询（每个查询禁用一组边）一次性求出各自的最小生成树总权重
+ *
+ * 按查询下标分治（查询即时间线上的时刻），用可撤销并查集（RollbackUnionFind）在递归间回滚。
+ * 对查询区间[l, r]，被区间内任一查询禁用的边为"未定边"，其余为"固定边"：
+ * - 收缩：未定边全部强制加入后，Kruskal仍选中的固定边对区间内每个查询都在MST中，直接合并；
+ * - 裁减：未定边全部去掉后，Kruskal仍不选的固定边对区间内每个查询都不在MST中，直接丢弃。
+ * 两步之后区间内剩余的固定边不超过未定边数，递归到左右两半时规模随查询数减半。
+ * 边权全序（BasicGraph::edgeLess）下结果与对每个查询删边后重新运行kruskalMST一致。
+ * 总耗时约O(E log V + K log Q log V)（K为各查询禁用边数之和），而逐个重算需O(Q·E log E)。
+ * 与BasicGraph一样按边权类型W模板化，在WhatIfMST.cpp中对四种边权类型显式实例化。
+ */
+
+#ifndef WHAT_IF_MST_H
+#define WHAT_IF_MST_H
+
+#include "Graph.h"
+#include <vector>
+
+template <typename W>
+class BasicWhatIfMST {
+public:
+    typedef BasicGraph<W> GraphType;
+    typedef typename GraphType::WeightSum WeightSum;
+
+    // 一个查询的结果
+    struct Result {
+        WeightSum totalWeight; // 最小生成森林的总权重（与getMSTTotalWeight同类型）
+        int edgeCount;         // 森林的边数；等于顶点数-1时禁用后图仍连通
+    };
+
+    /**
+     * @brief 求禁用给定边集后的最小生成树
+     * @param graph 图：边集不修改，但排序使用其工作区缓冲区，调用期间不能与其他线程共享
+     * @param forbidden forbidden[q]为第q个查询禁用的边在graph.getEdges()中的下标（可用findEdge取得）
+     * @param results 输出：results[q]为第q个查询的结果
+     * @note 越界的边下标会被忽略并给出警告
+     */
+    static void forbiddenEdgeQueries(GraphType& graph, const std::vector<std::vector<int>>& forbidden,
+                                     std::vector<Result>& results);
+
+    /**
+     * @brief 每个查询只禁用一条边的便捷形式
+     * @param forbiddenEdge forbiddenEdge[q]为第q个查询禁用的边下标
+     */
+    static void forbiddenEdgeQueries(GraphType& graph, const std::vector<int>& forbiddenEdge,
+                                     std::vector<Result>& results);
+};
+
+// 默认的整数边权版本，与Graph对应
+using WhatIfMST = BasicWhatIfMST<int>;
+
+#endif // WHAT_IF_MST_H